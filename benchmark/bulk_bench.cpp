@@ -0,0 +1,131 @@
+// Bulk relocate, copy and fill of 4096 elements per category, against std::uninitialized_copy of move iterators
+// plus destroy, std::copy_n and std::fill_n. Time is per element.
+#include "simpletemplate.hpp"
+#include "runtime_bench.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+
+using namespace ST;
+
+enum class Code : std::uint16_t { none, some };
+
+// Owns a heap object, so its moves and destructor are not trivial, but it never points into itself
+struct Handle
+{
+	explicit Handle(int value) : data(new int(value)) {}
+	Handle(Handle&& other) noexcept : data(other.data) { other.data = nullptr; }
+	~Handle() { delete data; }
+
+	int* data;
+};
+
+namespace ST
+{
+	template<>
+	struct TriviallyRelocatable<Handle> : BoolConstantTrue {};
+}
+
+constexpr size_t count = 4096;
+
+// Two raw buffers; objects live in the first one between measurements
+template<typename T>
+struct Buffers
+{
+	template<typename Make>
+	explicit Buffers(Make make)
+	{
+		for (size_t i = 0; i < count; ++i)
+			::new (static_cast<void*>(a + i)) T(make(i));
+	}
+
+	~Buffers()
+	{
+		for (size_t i = 0; i < count; ++i)
+			a[i].~T();
+		::operator delete(a);
+		::operator delete(b);
+	}
+
+	T* a = static_cast<T*>(::operator new(count * sizeof(T)));
+	T* b = static_cast<T*>(::operator new(count * sizeof(T)));
+};
+
+template<typename T>
+void std_relocate(T* first, size_t n, T* dest)
+{
+	std::uninitialized_copy(std::make_move_iterator(first), std::make_move_iterator(first + n), dest);
+	for (size_t i = 0; i < n; ++i)
+		first[i].~T();
+}
+
+template<typename T, typename Make>
+void run_relocate(const char* group, Make make)
+{
+	Buffers<T> buffers(make);
+	const double st = STBench::measure(2 * count, [&] {
+		relocate(buffers.a, count, buffers.b);
+		relocate(buffers.b, count, buffers.a);
+		STBench::do_not_optimize(buffers.a);
+	});
+	STBench::report(group, "relocate", count, st);
+	const double standard = STBench::measure(2 * count, [&] {
+		std_relocate(buffers.a, count, buffers.b);
+		std_relocate(buffers.b, count, buffers.a);
+		STBench::do_not_optimize(buffers.a);
+	});
+	STBench::report(group, "uninitialized_copy+destroy", count, standard);
+}
+
+template<typename T, typename Make>
+void run_copy_fill(const char* group, Make make)
+{
+	std::vector<T> source, target;
+	for (size_t i = 0; i < count; ++i)
+	{
+		source.push_back(make(i));
+		target.push_back(make(0));
+	}
+	const T value = make(7);
+
+	STBench::report(group, "copy_n", count, STBench::measure(count, [&] {
+		ST::copy_n(source.data(), count, target.data());
+		STBench::do_not_optimize(target.data());
+	}));
+	STBench::report(group, "std::copy_n", count, STBench::measure(count, [&] {
+		std::copy_n(source.data(), count, target.data());
+		STBench::do_not_optimize(target.data());
+	}));
+	STBench::report(group, "fill_n", count, STBench::measure(count, [&] {
+		ST::fill_n(target.data(), count, value);
+		STBench::do_not_optimize(target.data());
+	}));
+	STBench::report(group, "std::fill_n", count, STBench::measure(count, [&] {
+		std::fill_n(target.data(), count, value);
+		STBench::do_not_optimize(target.data());
+	}));
+}
+
+int main()
+{
+	static int pointee = 0;
+	const auto integral = [](size_t i) { return static_cast<std::int32_t>(i); };
+	const auto floating = [](size_t i) { return i * 0.5; };
+	const auto pointer = [](size_t i) { return &pointee + (i & 1); };
+	const auto enumeration = [](size_t i) { return static_cast<Code>(i & 1); };
+	const auto string = [](size_t i) { return std::string(24, static_cast<char>('a' + i % 26)); };
+
+	run_relocate<std::int32_t>("integral", integral);
+	run_relocate<double>("floating point", floating);
+	run_relocate<int*>("pointer", pointer);
+	run_relocate<Code>("enum", enumeration);
+	run_relocate<Handle>("relocatable class", [](size_t i) { return Handle(static_cast<int>(i)); });
+	run_relocate<std::string>("class", string);
+
+	run_copy_fill<std::int32_t>("integral", integral);
+	run_copy_fill<double>("floating point", floating);
+	run_copy_fill<int*>("pointer", pointer);
+	run_copy_fill<Code>("enum", enumeration);
+	run_copy_fill<std::string>("class", string);
+}
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+"""Checks that static_for and static_for_each compile to straight-line code.
+
+Disassembles the st_codegen_* functions of an object file built from codegen_kernels.cpp at -O2 and fails if any
+of them contains a conditional jump, a backward jump (a loop back-edge) or a call (an iteration not inlined).
+Understands the x86 and AArch64 disassembly of GNU objdump and llvm-objdump.
+
+    python3 codegen_check.py --objdump objdump build/codegen_kernels.o
+"""
+import argparse
+import re
+import subprocess
+import sys
+
+PREFIX = 'st_codegen_'
+FUNCTION = re.compile(r'^[0-9a-f]+ <_?(%s\w*)>:$' % PREFIX)
+INSTRUCTION = re.compile(r'^\s*([0-9a-f]+):\s+(?:[0-9a-f]{2,8} )*\s*([a-z][\w.]*)\s*(.*)$')
+TARGET = re.compile(r'^(?:0x)?([0-9a-f]+)\b')
+
+# x86: every j<cc> but jmp, and the loop family; AArch64: b.<cc>, cbz/cbnz, tbz/tbnz
+CONDITIONAL = re.compile(r'^(j(?!mp)[a-z]+|loop\w*|jrcxz|jecxz|b\.\w+|cbn?z|tbn?z)$')
+JUMP = re.compile(r'^(jmp\w*|b)$')
+CALL = re.compile(r'^(call\w*|bl|blr)$')
+
+
+def disassemble(objdump, path):
+    result = subprocess.run([objdump, '-d', '--no-show-raw-insn', path],
+                            stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
+    if result.returncode != 0:
+        raise RuntimeError(result.stderr.strip() or '%s failed' % objdump)
+    functions = {}
+    current = None
+    for line in result.stdout.splitlines():
+        match = FUNCTION.match(line)
+        if match:
+            current = functions.setdefault(match.group(1), [])
+            continue
+        if not line.strip():
+            current = None
+            continue
+        match = INSTRUCTION.match(line)
+        if current is not None and match:
+            current.append((int(match.group(1), 16), match.group(2), match.group(3)))
+    return functions
+
+
+def problems(instructions):
+    found = []
+    for address, mnemonic, operands in instructions:
+        if CONDITIONAL.match(mnemonic):
+            found.append('%x: conditional jump %s %s' % (address, mnemonic, operands))
+        elif JUMP.match(mnemonic):
+            target = TARGET.match(operands)
+            if target and int(target.group(1), 16) <= address:
+                found.append('%x: backward jump %s %s' % (address, mnemonic, operands))
+        elif CALL.match(mnemonic):
+            found.append('%x: call %s' % (address, operands))
+    return found
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('objects', nargs='+')
+    parser.add_argument('--objdump', default='objdump')
+    args = parser.parse_args()
+
+    failed = False
+    checked = 0
+    for path in args.objects:
+        try:
+            functions = disassemble(args.objdump, path)
+        except (OSError, RuntimeError) as e:
+            print('%s: %s' % (path, e), file=sys.stderr)
+            return 1
+        for name, instructions in sorted(functions.items()):
+            checked += 1
+            found = problems(instructions)
+            print('%-40s %4d instructions  %s' % (name, len(instructions), 'FAILED' if found else 'ok'))
+            for problem in found:
+                print('    ' + problem)
+            failed = failed or bool(found)
+    if not checked:
+        print('no %s* functions found' % PREFIX, file=sys.stderr)
+        return 1
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
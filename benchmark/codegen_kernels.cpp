@@ -0,0 +1,54 @@
+// Kernels disassembled by codegen_check.py: each must compile at -O2 to straight-line code, with no conditional
+// jump, no backward jump and no call, i.e. static_for and static_for_each fully unrolled and inlined.
+#include "simpletemplate.hpp"
+
+using namespace ST;
+
+extern "C" {
+
+// 16 lanes: a dot product and an element-wise update
+float st_codegen_static_for_16(const float* a, const float* b)
+{
+	float sum = 0;
+	static_for(0_c, 16_c, [&](auto i) { sum += a[static_cast<int>(i)] * b[static_cast<int>(i)]; });
+	return sum;
+}
+
+void st_codegen_static_for_16_update(int* out, const int* in)
+{
+	static_for(0_c, 16_c, [&](auto i) { out[static_cast<int>(i)] += in[static_cast<int>(i)] * static_cast<int>(i); });
+}
+
+// Early stop: iterations 0 to 4 run, the other 251 are instantiated but emit nothing
+int st_codegen_static_for_early_stop(int* out)
+{
+	int sum = 0;
+	static_for(0_c, 256_c, [&](auto i) {
+		out[static_cast<int>(i)] = static_cast<int>(i);
+		sum += out[static_cast<int>(i)];
+		return BoolConstant<(static_cast<int>(decltype(i){}) < 4)>{};
+	});
+	return sum;
+}
+
+// One iteration per type
+unsigned st_codegen_static_for_each(const unsigned char* bytes)
+{
+	unsigned total = 0;
+	static_for_each(List<char, short, int, long long>{}, [&](auto t) { total += bytes[static_cast<size_t>(t.size())]; });
+	return total;
+}
+
+// Find: stops on the matching type, here the last one, which still makes the result false_c
+int st_codegen_static_for_each_find(const int* sizes)
+{
+	int sum = 0;
+	auto completed = static_for_each(List<char, short, int, long long>{}, [&](auto t) {
+		sum += sizes[static_cast<size_t>(t.size())];
+		return t != tag<long long>;
+	});
+	static_assert(std::is_same<decltype(completed), BoolConstantFalse>::value, "static_for_each: stopping on the last iteration returns false_c");
+	return sum;
+}
+
+} // extern "C"
@@ -0,0 +1,309 @@
+#!/usr/bin/env python3
+"""Compile-time benchmark for simpletemplate.hpp.
+
+Generates synthetic translation units for each workload at several sizes, compiles them with every
+given compiler and records wall time, peak compiler RSS and, with Clang, the number of template
+instantiations from -ftime-trace. GCC runs with -ftime-report, whose phase timings are recorded too.
+The JSON output is meant to be diffed between commits.
+
+    python3 compile_bench.py --compiler g++ --compiler clang++ --output results.json
+    python3 compile_bench.py --compiler g++ --workload list_index --sizes 10 100 1000 2000
+"""
+import argparse
+import json
+import os
+import re
+import signal
+import subprocess
+import sys
+import tempfile
+import time
+
+HEADER_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), '..'))
+
+
+def gen_types(n):
+    return ''.join('struct T%d {};\n' % i for i in range(n))
+
+
+def lookup_indices(n, lookups):
+    step = max(1, n // lookups)
+    return list(range(0, n, step))[:lookups] + [n - 1]
+
+
+# Each workload maps (size, variant) to the source of one translation unit.
+
+def workload_list_index(n, variant):
+    if variant == 'tuple' and n > 2000:
+        return None  # std::tuple_element needs several GB beyond this
+    src = '#include "simpletemplate.hpp"\n'
+    if variant == 'tuple':
+        src += '#include <tuple>\n'
+    src += gen_types(n)
+    src += 'using L = ST::List<%s>;\n' % ', '.join('T%d' % i for i in range(n))
+    src += 'using Tu = std::tuple<%s>;\n' % ', '.join('T%d' % i for i in range(n)) if variant == 'tuple' else ''
+    for i in lookup_indices(n, 64):
+        if variant == 'tuple':
+            src += 'static_assert(std::is_same<std::tuple_element_t<%d, Tu>, T%d>::value, "");\n' % (i, i)
+        else:
+            src += 'static_assert(L{}[ST::IntegralConstant<unsigned, %d>{}] == ST::tag<T%d>, "");\n' % (i, i)
+    return src + 'int main() {}\n'
+
+
+def workload_list_slice(n, variant):
+    src = '#include "simpletemplate.hpp"\n' + gen_types(n)
+    src += 'using L = ST::List<%s>;\n' % ', '.join('T%d' % i for i in range(n))
+    src += 'using ST::IntegralConstant;\n'
+    src += 'static_assert(ST::reverse(ST::reverse(L{})) == L{}, "");\n'
+    src += 'static_assert(ST::take(L{}, IntegralConstant<unsigned, %d>{}) + ST::drop(L{}, IntegralConstant<unsigned, %d>{}) == L{}, "");\n' % (n // 3, n // 3)
+    src += 'static_assert(ST::rotate(L{}, IntegralConstant<unsigned, %d>{})[IntegralConstant<unsigned, 0>{}] == ST::tag<T%d>, "");\n' % (n // 2, n // 2)
+    return src + 'int main() {}\n'
+
+
+def workload_list_set(n, variant):
+    # 'repeated' lists every type twice, so that unique has real work to do
+    distinct = n // 2 or 1 if variant == 'repeated' else n
+    src = '#include "simpletemplate.hpp"\n' + gen_types(n)
+    src += 'using L = ST::List<%s>;\n' % ', '.join('T%d' % (i % distinct) for i in range(n))
+    src += 'using H = ST::List<%s>;\n' % ', '.join('T%d' % i for i in range(0, n, 2))
+    src += 'static_assert(ST::unique(L{}).length == ST::IntegralConstant<unsigned, %d>{}, "");\n' % distinct
+    src += 'static_assert(ST::set_union(ST::unique(L{}), H{}) == ST::unique(L{} + H{}), "");\n'
+    src += 'static_assert(ST::set_intersection(L{}, H{}) + ST::set_difference(L{}, H{}) != L{}, "");\n'
+    src += 'static_assert(ST::contains(L{}, ST::tag<T0>), "");\n'
+    src += 'static_assert(ST::index_of(L{}, ST::tag<T%d>) == ST::IntegralConstant<unsigned, %d>{}, "");\n' % (distinct - 1, distinct - 1)
+    return src + 'int main() {}\n'
+
+
+def workload_list_sort(n, variant):
+    # Types of 64 different sizes in scrambled order, sorted by size or by hash
+    src = '#include "simpletemplate.hpp"\n'
+    src += ''.join('struct T%d { char c[%d]; };\n' % (i, (i * 37) % 64 + 1) for i in range(n))
+    src += 'using L = ST::List<%s>;\n' % ', '.join('T%d' % i for i in range(n))
+    src += 'constexpr auto sorted = ST::sort(L{}, ST::%s_key);\n' % variant
+    src += 'static_assert(ST::sort(sorted, ST::%s_key) == sorted, "");\n' % variant
+    if variant == 'size':
+        src += 'static_assert(sorted[ST::IntegralConstant<unsigned, 0>{}] == ST::tag<T0>, "");\n'
+    return src + 'int main() {}\n'
+
+
+def workload_type_map(n, variant):
+    # A type_map over n types, looked up statically and by hash
+    src = '#include "simpletemplate.hpp"\n' + gen_types(n)
+    src += 'using M = ST::type_map<ST::List<%s>, int>;\n' % ', '.join('T%d' % i for i in range(n))
+    src += 'int f(M& m, unsigned long long hash) { m[ST::tag<T%d>] = 1; return *m.find(hash); }\n' % (n - 1)
+    return src + 'int main() {}\n'
+
+
+def workload_list_group(n, variant):
+    # n types cycling through five categories, grouped by category or filtered into integral and other types
+    forms = ['int', 'float', 'C%d', 'C%d*', 'E%d']
+    src = '#include "simpletemplate.hpp"\n'
+    src += ''.join('struct C%d {}; enum E%d {};\n' % (i, i) for i in range(n // len(forms) + 1))
+    src += 'using L = ST::List<%s>;\n' % ', '.join(
+        ('%s' % forms[i % len(forms)]).replace('%d', str(i // len(forms))) for i in range(n))
+    if variant == 'group':
+        src += 'static_assert(ST::group_by(L{}, ST::category_key).length == ST::IntegralConstant<unsigned, %d>{}, "");\n' % min(n, len(forms))
+    else:
+        src += 'struct IsIntegral { template<typename T> constexpr auto operator()(ST::Tag<T> t) const { return t.category() == ST::integral_tag; } };\n'
+        src += 'static_assert(ST::partition(L{}, IsIntegral{}).first.length == ST::IntegralConstant<unsigned, %d>{}, "");\n' % ((n + 4) // 5)
+    return src + 'int main() {}\n'
+
+
+def workload_list_checks(n, variant):
+    # Whole-pack checks over n types: dispatch's common return type, or variant's requirements on its alternatives
+    src = '#include "simpletemplate.hpp"\n' + gen_types(n)
+    src += 'using L = ST::List<%s>;\n' % ', '.join('T%d' % i for i in range(n))
+    if variant == 'dispatch':
+        src += 'int f(unsigned i) { return ST::dispatch(L{}, i, [](auto t) { return int(t.size()); }); }\n'
+    else:
+        src += 'int f(const ST::variant<L>& v) { return int(v.index()); }\n'
+    return src + 'int main() {}\n'
+
+
+HEADERS = ['integral', 'category', 'tag', 'list', 'callable', 'loop', 'dispatch', 'soa', 'packed_tuple',
+           'inplace_function', 'type_map', 'variant', 'bulk', 'fields', 'table']
+
+
+def workload_parse(n, variant):
+    # Parse time of one header on its own; the size is unused
+    header = 'simpletemplate.hpp' if variant == 'all' else 'st/%s.hpp' % variant
+    return '#include "%s"\nint main() {}\n' % header
+
+
+def workload_lookup_table(n, variant):
+    # A CRC-32 style table of n entries built by make_table, with or without minimal_element
+    src = '#include "simpletemplate.hpp"\n'
+    src += 'struct Crc { constexpr unsigned operator()(unsigned long i) const { unsigned c = static_cast<unsigned>(i);\n'
+    src += '    for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1; return c; } };\n'
+    src += 'constexpr auto table = ST::make_table<%d>(Crc{}%s);\n' % (n, ', ST::minimal_element' if variant == 'minimal' else '')
+    src += 'unsigned f(unsigned i) { return table[i %% %d]; }\n' % n
+    return src + 'int main() {}\n'
+
+
+def workload_type_category(n, variant):
+    # n distinct types cycling through every category, each queried once
+    forms = [
+        ('struct C%d {};', 'C%d', 'class_tag'),
+        ('enum E%d { e%d };', 'E%d', 'enum_tag'),
+        ('union U%d { int i; };', 'U%d', 'union_tag'),
+        ('', 'C%d*', 'pointer_tag'),
+        ('', 'C%d[3]', 'array_tag'),
+        ('', 'C%d&', 'lvalue_reference_tag'),
+        ('', 'C%d&&', 'rvalue_reference_tag'),
+        ('', 'void(C%d)', 'function_tag'),
+        ('', 'int C%d::*', 'pointer_to_member_object_tag'),
+        ('', 'void (C%d::*)()', 'pointer_to_member_function_tag'),
+        ('', 'const volatile E%d', 'enum_tag'),
+    ]
+    classes = n // len(forms) + 1
+    src = '#include "simpletemplate.hpp"\n'
+    for i in range(classes):
+        src += 'struct C%d {}; enum E%d { e%d }; union U%d { int i; };\n' % (i, i, i, i)
+    for q in range(n):
+        _, type_form, category = forms[q % len(forms)]
+        src += 'static_assert(ST::tag<%s>.category() == ST::%s, "");\n' % (type_form % (q // len(forms)), category)
+    return src + 'int main() {}\n'
+
+
+def workload_literals(n, variant):
+    # n distinct wide literals, in all four bases
+    src = '#include "simpletemplate.hpp"\nusing ST::operator""_c;\n'
+    for i in range(n):
+        value = (0x5DEECE66D * (i + 1) * 0x9E3779B97F4A7C15) % (1 << 62)
+        text = [str(value), hex(value), '0b' + bin(value)[2:], '0' + oct(value)[2:]][i % 4]
+        src += 'static_assert(%s_c == ST::IntegralConstant<long long, %dLL>{}, "");\n' % (text, value)
+    return src + 'int main() {}\n'
+
+
+# name: (generator, variants, default sizes)
+WORKLOADS = {
+    'list_index': (workload_list_index, ['st', 'tuple'], [10, 100, 1000, 10000]),
+    'list_slice': (workload_list_slice, ['st'], [10, 100, 1000]),
+    'list_set': (workload_list_set, ['distinct', 'repeated'], [10, 100, 1000]),
+    'list_sort': (workload_list_sort, ['size', 'hash'], [10, 100, 1000]),
+    'list_group': (workload_list_group, ['group', 'partition'], [10, 100, 1000]),
+    'list_checks': (workload_list_checks, ['dispatch', 'variant'], [100, 1000, 2000]),
+    'type_map': (workload_type_map, ['st'], [100, 1000, 4000]),
+    'parse': (workload_parse, HEADERS + ['all'], [1]),
+    'lookup_table': (workload_lookup_table, ['st', 'minimal'], [256, 4096, 65536]),
+    'type_category': (workload_type_category, ['st'], [100, 1000, 5000]),
+    'literals': (workload_literals, ['st'], [100, 1000, 5000]),
+}
+
+
+def count_instantiations(trace_file):
+    try:
+        with open(trace_file) as f:
+            events = json.load(f).get('traceEvents', [])
+    except (OSError, ValueError):
+        return None
+    return sum(1 for e in events if e.get('name') in ('InstantiateClass', 'InstantiateFunction'))
+
+
+def gcc_phases(report):
+    phases = {}
+    for line in report.splitlines():
+        m = re.match(r'\s*\|?\s*([a-z][a-z /-]+?)\s*:\s*([0-9.]+)\s*\(', line)
+        if m and m.group(1) in ('template instantiation', 'constant expression evaluation', 'overload resolution',
+                                'name lookup', 'phase parsing', 'TOTAL'):
+            phases[m.group(1)] = float(m.group(2))
+    m = re.search(r'TOTAL\s*:\s*([0-9.]+)', report)
+    if m:
+        phases['TOTAL'] = float(m.group(1))
+    return phases
+
+
+def is_clang(compiler):
+    out = subprocess.run([compiler, '--version'], stdout=subprocess.PIPE, universal_newlines=True).stdout
+    return 'clang' in out
+
+
+def git_commit():
+    try:
+        return subprocess.run(['git', '-C', HEADER_DIR, 'rev-parse', 'HEAD'], stdout=subprocess.PIPE,
+                              stderr=subprocess.DEVNULL, universal_newlines=True).stdout.strip() or None
+    except OSError:
+        return None
+
+
+def compile_one(compiler, clang, std, source, workdir, timeout):
+    cpp = os.path.join(workdir, 'tu.cpp')
+    obj = os.path.join(workdir, 'tu.o')
+    with open(cpp, 'w') as f:
+        f.write(source)
+    cmd = [compiler, '-std=' + std, '-I', HEADER_DIR, '-c', cpp, '-o', obj]
+    if clang:
+        cmd += ['-ftime-trace', '-ftime-trace-granularity=0']
+    else:
+        cmd += ['-ftime-report']
+    errfile = open(os.path.join(workdir, 'stderr.txt'), 'w+')
+    start = time.monotonic()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=errfile)
+    timed_out = False
+    while True:
+        pid, status, usage = os.wait4(proc.pid, os.WNOHANG)
+        if pid:
+            break
+        if time.monotonic() - start > timeout:
+            os.kill(proc.pid, signal.SIGKILL)
+            timed_out = True
+        time.sleep(0.01)
+    wall = time.monotonic() - start
+    errfile.seek(0)
+    stderr = errfile.read()
+    errfile.close()
+    result = {
+        'ok': not timed_out and os.WIFEXITED(status) and os.WEXITSTATUS(status) == 0,
+        'timed_out': timed_out,
+        'wall_s': round(wall, 4),
+        'peak_rss_kb': usage.ru_maxrss,
+        'instantiations': count_instantiations(os.path.join(workdir, 'tu.json')) if clang else None,
+    }
+    if not clang:
+        result['phases_s'] = gcc_phases(stderr)
+    if not result['ok'] and not timed_out:
+        result['error'] = stderr[-2000:]
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--compiler', action='append', help='may be repeated (default: $CXX or c++)')
+    parser.add_argument('--std', default='c++14')
+    parser.add_argument('--workload', choices=sorted(WORKLOADS), action='append', help='may be repeated (default: all)')
+    parser.add_argument('--sizes', type=int, nargs='+', help='overrides the default sizes of every workload')
+    parser.add_argument('--timeout', type=float, default=600, help='seconds allowed per translation unit')
+    parser.add_argument('--output', help='JSON result file (default: stdout)')
+    args = parser.parse_args()
+
+    compilers = args.compiler or [os.environ.get('CXX', 'c++')]
+    results = []
+    for compiler in compilers:
+        clang = is_clang(compiler)
+        for name in args.workload or sorted(WORKLOADS):
+            generate, variants, default_sizes = WORKLOADS[name]
+            for size in args.sizes or default_sizes:
+                for variant in variants:
+                    source = generate(size, variant)
+                    if source is None:
+                        continue
+                    with tempfile.TemporaryDirectory() as workdir:
+                        r = compile_one(compiler, clang, args.std, source, workdir, args.timeout)
+                    r.update(workload=name, variant=variant, size=size, compiler=compiler, std=args.std)
+                    results.append(r)
+                    print('%-10s %-14s %-9s %6d  %8.3fs  %9d KB  %8s %s' % (
+                        os.path.basename(compiler), name, variant, size, r['wall_s'], r['peak_rss_kb'],
+                        r['instantiations'] if r['instantiations'] is not None else '-',
+                        '' if r['ok'] else ('TIMEOUT' if r['timed_out'] else 'FAILED')), file=sys.stderr)
+
+    text = json.dumps({'commit': git_commit(), 'results': results}, indent=2)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text + '\n')
+    else:
+        print(text)
+    return 0 if all(r['ok'] for r in results) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,94 @@
+// Runtime-index dispatch over a List of N message types: function pointer table, nested switch and
+// the hand-written if/else chain it replaces. Indices are random so the chain mispredicts.
+#include "simpletemplate.hpp"
+#include "runtime_bench.hpp"
+
+using namespace ST;
+
+template<size_t N>
+struct Message
+{
+	static constexpr std::uint64_t id = N * 0x9E3779B97F4A7C15ull;
+};
+
+template<typename Indices>
+struct MessagesOf;
+
+template<size_t... Ns>
+struct MessagesOf<std::index_sequence<Ns...>>
+{
+	using Type = List<Message<Ns>...>;
+};
+
+template<size_t N>
+using Messages = typename MessagesOf<std::make_index_sequence<N>>::Type;
+
+// if (index == 0) ... else if (index == 1) ...
+template<size_t I, size_t N>
+struct IfChain
+{
+	template<typename L, typename F>
+	static void invoke(L l, size_t index, F& f)
+	{
+		if (index == I)
+			f(l[IntegralConstant<size_t, I>{}]);
+		else
+			IfChain<I + 1, N>::invoke(l, index, f);
+	}
+};
+
+template<size_t N>
+struct IfChain<N, N>
+{
+	template<typename L, typename F>
+	static void invoke(L, size_t, F&) {}
+};
+
+struct Handler
+{
+	std::uint64_t state = 0;
+
+	template<typename T>
+	void operator()(T)
+	{
+		state = (state ^ T::Type::id) * 31;
+	}
+};
+
+template<size_t N>
+void run(const std::vector<size_t>& indices)
+{
+	const Messages<N> messages;
+
+	const double table = STBench::measure(indices.size(), [&] {
+		Handler handler;
+		for (size_t index : indices)
+			dispatch(messages, index, handler);
+		STBench::do_not_optimize(handler.state);
+	});
+	STBench::report("dispatch", "table", N, table);
+
+	const double switched = STBench::measure(indices.size(), [&] {
+		Handler handler;
+		for (size_t index : indices)
+			dispatch(messages, index, handler, switch_dispatch);
+		STBench::do_not_optimize(handler.state);
+	});
+	STBench::report("dispatch", "switch", N, switched);
+
+	const double chain = STBench::measure(indices.size(), [&] {
+		Handler handler;
+		for (size_t index : indices)
+			IfChain<0, N>::invoke(messages, index, handler);
+		STBench::do_not_optimize(handler.state);
+	});
+	STBench::report("dispatch", "if chain", N, chain);
+}
+
+int main()
+{
+	constexpr size_t calls = 1 << 20;
+	run<8>(STBench::random_indices(calls, 8));
+	run<64>(STBench::random_indices(calls, 64));
+	run<512>(STBench::random_indices(calls, 512));
+}
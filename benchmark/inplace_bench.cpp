@@ -0,0 +1,56 @@
+// Call overhead and copy cost of inplace_function against std::function, for a capture that fits in
+// std::function's small buffer, a larger trivially copyable capture and a capture owning a std::string.
+#include "simpletemplate.hpp"
+#include "runtime_bench.hpp"
+
+#include <functional>
+#include <string>
+
+using namespace ST;
+
+struct Wide
+{
+	std::uint64_t values[5];
+};
+
+template<typename Function, typename F>
+void run(const char* group, const char* name, F f)
+{
+	constexpr size_t operations = 1 << 20;
+
+	Function function = f;
+	const double call = STBench::measure(operations, [&] {
+		std::uint64_t sum = 0;
+		for (size_t i = 0; i < operations; ++i)
+		{
+			STBench::do_not_optimize(function);
+			sum += function(i);
+		}
+		STBench::do_not_optimize(sum);
+	});
+	STBench::report(group, (std::string(name) + " call").c_str(), operations, call);
+
+	const double copy = STBench::measure(operations, [&] {
+		for (size_t i = 0; i < operations; ++i)
+		{
+			Function duplicate = function;
+			STBench::do_not_optimize(duplicate);
+		}
+	});
+	STBench::report(group, (std::string(name) + " copy").c_str(), operations, copy);
+}
+
+int main()
+{
+	std::uint64_t offset = 7;
+	const auto small = [&offset](std::uint64_t x) { return x + offset; };
+	const auto wide = [wide = Wide{ { 1, 2, 3, 4, 5 } }](std::uint64_t x) { return x + wide.values[x % 5]; };
+	const auto owning = [text = std::string(40, 'x')](std::uint64_t x) { return x + text.size(); };
+
+	run<std::function<std::uint64_t(std::uint64_t)>>("small capture", "std::function", small);
+	run<inplace_function<std::uint64_t(std::uint64_t), 64>>("small capture", "inplace_function", small);
+	run<std::function<std::uint64_t(std::uint64_t)>>("40-byte trivial capture", "std::function", wide);
+	run<inplace_function<std::uint64_t(std::uint64_t), 64>>("40-byte trivial capture", "inplace_function", wide);
+	run<std::function<std::uint64_t(std::uint64_t)>>("std::string capture", "std::function", owning);
+	run<inplace_function<std::uint64_t(std::uint64_t), 64>>("std::string capture", "inplace_function", owning);
+}
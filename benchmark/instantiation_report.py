@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Instantiation report for binaries built with ST_INSTRUMENT.
+
+With ST_INSTRUMENT defined (the CMake option of the same name sets it), every instantiation of an instrumented
+template of simpletemplate.hpp leaves one record in the binary: List operations, type_category, the _c and _uc
+literal parsers and the Tag traits. This script finds the records in executables, shared libraries or object files,
+whatever their format, and prints the number of distinct instantiations of each operation and the longest list seen.
+
+    python3 instantiation_report.py build/my_program
+    python3 instantiation_report.py --sort length --json report.json build/my_program
+
+Records of an instantiation seen by several translation units are merged by the linker, so run it on the linked
+binary; object files are counted separately. MSVC keeps the records only when linking with /OPT:NOREF.
+"""
+import argparse
+import json
+import struct
+import sys
+
+# Details::InstrumentationRecord in st/instrument.hpp
+MAGIC = b'STINSTR\x01'
+RECORD = struct.Struct('<8s48sQ')
+
+
+def read_records(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    records = []
+    offset = data.find(MAGIC)
+    while 0 <= offset <= len(data) - RECORD.size:
+        _, name, length = RECORD.unpack_from(data, offset)
+        name, terminator, _ = name.partition(b'\0')
+        # The magic bytes can also appear by chance, e.g. as an immediate in code
+        if terminator and name and all(32 < c < 127 for c in name):
+            records.append((name.decode('ascii'), length))
+            offset = data.find(MAGIC, offset + RECORD.size)
+        else:
+            offset = data.find(MAGIC, offset + 1)
+    return records
+
+
+def summarize(records):
+    operations = {}
+    for name, length in records:
+        count, longest = operations.get(name, (0, 0))
+        operations[name] = (count + 1, max(longest, length))
+    return operations
+
+
+def print_report(path, operations, order):
+    keys = {
+        'count': lambda item: (-item[1][0], item[0]),
+        'length': lambda item: (-item[1][1], item[0]),
+        'name': lambda item: item[0],
+    }
+    print(path)
+    print('%-24s %14s %12s' % ('operation', 'instantiations', 'max length'))
+    for name, (count, longest) in sorted(operations.items(), key=keys[order]):
+        print('%-24s %14d %12s' % (name, count, longest if name.startswith('list.') or longest else '-'))
+    print('%-24s %14d' % ('total', sum(count for count, _ in operations.values())))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('binaries', nargs='+')
+    parser.add_argument('--sort', choices=['count', 'length', 'name'], default='count')
+    parser.add_argument('--json', help='also writes the counts to this file')
+    args = parser.parse_args()
+
+    results = {}
+    for path in args.binaries:
+        try:
+            operations = summarize(read_records(path))
+        except OSError as e:
+            print('%s: %s' % (path, e.strerror), file=sys.stderr)
+            continue
+        if not operations:
+            print('%s: no records; was it compiled with ST_INSTRUMENT defined?' % path, file=sys.stderr)
+            continue
+        print_report(path, operations, args.sort)
+        results[path] = {name: {'instantiations': count, 'max_length': longest}
+                         for name, (count, longest) in operations.items()}
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+    return 0 if results else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,94 @@
+// Equality and hash of a 32-byte composite key: Fields::equal and Fields::hash, which read the key as whole words,
+// against a hand-written operator== with short-circuit branches and a per-member hash_combine. Half of the
+// compared pairs are equal, at random, and unequal pairs differ in a random member.
+#include "simpletemplate.hpp"
+#include "runtime_bench.hpp"
+
+#include <functional>
+
+using namespace ST;
+
+struct Key
+{
+	std::uint32_t table;
+	std::uint32_t column;
+	std::uint64_t row;
+	std::int16_t shard[4];
+	std::uint64_t version;
+};
+
+using KeyFields = Fields<ST_FIELD(&Key::table), ST_FIELD(&Key::column), ST_FIELD(&Key::row), ST_FIELD(&Key::shard), ST_FIELD(&Key::version)>;
+static_assert(KeyFields::compares_blocks(), "Key should be compared as whole words");
+
+bool operator==(const Key& a, const Key& b)
+{
+	return a.table == b.table && a.column == b.column && a.row == b.row && a.shard[0] == b.shard[0] && a.shard[1] == b.shard[1]
+		&& a.shard[2] == b.shard[2] && a.shard[3] == b.shard[3] && a.version == b.version;
+}
+
+template<typename T>
+void hash_combine(std::size_t& seed, const T& value)
+{
+	seed ^= std::hash<T>{}(value) + 0x9E3779B9 + (seed << 6) + (seed >> 2);
+}
+
+std::size_t hash_by_hand(const Key& key)
+{
+	std::size_t seed = 0;
+	hash_combine(seed, key.table);
+	hash_combine(seed, key.column);
+	hash_combine(seed, key.row);
+	for (std::int16_t s : key.shard)
+		hash_combine(seed, s);
+	hash_combine(seed, key.version);
+	return seed;
+}
+
+int main()
+{
+	constexpr size_t count = 1 << 16;
+
+	std::vector<Key> left(count), right(count);
+	const std::vector<size_t> random = STBench::random_indices(2 * count, 1 << 16);
+	for (size_t i = 0; i < count; ++i)
+	{
+		left[i] = Key{ 7, static_cast<std::uint32_t>(i & 15), i, { 1, 2, 3, 4 }, 99 };
+		right[i] = left[i];
+		if (random[i] & 1)
+		{
+			switch (random[count + i] % 5)
+			{
+			case 0: right[i].table++; break;
+			case 1: right[i].column++; break;
+			case 2: right[i].row++; break;
+			case 3: right[i].shard[random[i] % 4]++; break;
+			default: right[i].version++; break;
+			}
+		}
+	}
+
+	STBench::report("equality", "Fields::equal", count, STBench::measure(count, [&] {
+		size_t equal = 0;
+		for (size_t i = 0; i < count; ++i)
+			equal += KeyFields::equal(left[i], right[i]);
+		STBench::do_not_optimize(equal);
+	}));
+	STBench::report("equality", "operator== by member", count, STBench::measure(count, [&] {
+		size_t equal = 0;
+		for (size_t i = 0; i < count; ++i)
+			equal += left[i] == right[i];
+		STBench::do_not_optimize(equal);
+	}));
+	STBench::report("hash", "Fields::hash", count, STBench::measure(count, [&] {
+		std::uint64_t sum = 0;
+		for (const Key& key : left)
+			sum += KeyFields::hash(key);
+		STBench::do_not_optimize(sum);
+	}));
+	STBench::report("hash", "hash_combine by member", count, STBench::measure(count, [&] {
+		std::uint64_t sum = 0;
+		for (const Key& key : left)
+			sum += hash_by_hand(key);
+		STBench::do_not_optimize(sum);
+	}));
+}
@@ -0,0 +1,36 @@
+// Module check: a translation unit that only imports ST. Constructs a variant, whose storage uses placement new,
+// and decomposes a packed_tuple through its tuple protocol; neither <new> nor <utility> is included here.
+import ST;
+
+using namespace ST;
+
+struct Counted
+{
+	explicit Counted(int& live) : live(&live) { ++live; }
+	Counted(Counted&& other) noexcept : live(other.live) { ++*live; }
+	~Counted() { --*live; }
+
+	int* live;
+};
+
+int main()
+{
+	int live = 0;
+	{
+		variant<List<int, double, Counted>> v = 2.5;
+		if (!v.holds(tag<double>) || v.visit([](const auto& x) { return sizeof(x); }) != sizeof(double))
+			return 1;
+		v.emplace(tag<Counted>, live);
+		if (v.index() != 2 || live != 1)
+			return 2;
+		v = 7;
+		if (*v.get_if(tag<int>) != 7 || live != 0)
+			return 3;
+	}
+
+	packed_tuple<char, double, int> t('a', 1.5, 3);
+	auto [c, d, i] = t;
+	if (c != 'a' || d != 1.5 || i != 3 || t[1_c] != 1.5)
+		return 4;
+	return 0;
+}
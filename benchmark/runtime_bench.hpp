@@ -0,0 +1,56 @@
+#pragma once
+// Minimal harness shared by the runtime benchmarks: each case runs a callable over a fixed number of
+// operations, keeps the fastest of several repetitions and prints nanoseconds per operation.
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace STBench
+{
+	// Keeps the compiler from discarding a computed value
+	template<typename T>
+	inline void do_not_optimize(const T& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static volatile const T* sink;
+		sink = &value;
+#endif
+	}
+
+	// Fastest of `repetitions` runs of body(), in nanoseconds per operation
+	template<typename Body>
+	double measure(std::size_t operations, Body&& body, int repetitions = 7)
+	{
+		double best = 1e300;
+		for (int r = 0; r < repetitions; ++r)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			body();
+			const auto stop = std::chrono::steady_clock::now();
+			const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / operations;
+			if (ns < best)
+				best = ns;
+		}
+		return best;
+	}
+
+	inline void report(const char* group, const char* name, std::size_t size, double ns_per_op)
+	{
+		std::printf("%-24s %-26s %8zu %10.3f ns/op\n", group, name, size, ns_per_op);
+	}
+
+	// Uniformly distributed indices in [0, bound), with a fixed seed so runs are comparable
+	inline std::vector<std::size_t> random_indices(std::size_t count, std::size_t bound)
+	{
+		std::mt19937_64 engine(42);
+		std::uniform_int_distribution<std::size_t> distribution(0, bound - 1);
+		std::vector<std::size_t> indices(count);
+		for (auto& index : indices)
+			index = distribution(engine);
+		return indices;
+	}
+}
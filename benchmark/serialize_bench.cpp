@@ -0,0 +1,126 @@
+// Encode and decode throughput of a Fields serializer against a hand-written codec that copies each member
+// separately, in native (little endian) and big endian byte order. Throughput is in wire bytes per nanosecond.
+#include "simpletemplate.hpp"
+#include "runtime_bench.hpp"
+
+#include <utility>
+#include <vector>
+
+using namespace ST;
+
+struct Order
+{
+	std::uint64_t id;
+	std::uint32_t quantity;
+	std::uint32_t price;
+	double limit;
+	char symbol[8];
+	std::uint16_t flags;
+	std::uint8_t side;
+};
+
+using OrderFields = Fields<ST_FIELD(&Order::id), ST_FIELD(&Order::quantity), ST_FIELD(&Order::price), ST_FIELD(&Order::limit),
+	ST_FIELD(&Order::symbol), ST_FIELD(&Order::flags), ST_FIELD(&Order::side)>;
+
+constexpr size_t wire = static_cast<size_t>(OrderFields::wire_size());
+
+// The hand-written codec: one memcpy per member, reversing the bytes when the order differs
+template<typename T>
+unsigned char* put(unsigned char* out, const T& value, bool swap)
+{
+	unsigned char bytes[sizeof(T)];
+	std::memcpy(bytes, &value, sizeof(T));
+	for (size_t i = 0; swap && i < sizeof(T) / 2; ++i)
+		std::swap(bytes[i], bytes[sizeof(T) - 1 - i]);
+	std::memcpy(out, bytes, sizeof(T));
+	return out + sizeof(T);
+}
+
+template<typename T>
+const unsigned char* get(const unsigned char* in, T& value, bool swap)
+{
+	unsigned char bytes[sizeof(T)];
+	std::memcpy(bytes, in, sizeof(T));
+	for (size_t i = 0; swap && i < sizeof(T) / 2; ++i)
+		std::swap(bytes[i], bytes[sizeof(T) - 1 - i]);
+	std::memcpy(&value, bytes, sizeof(T));
+	return in + sizeof(T);
+}
+
+template<bool Swap>
+unsigned char* encode_by_hand(const Order& order, unsigned char* out)
+{
+	out = put(out, order.id, Swap);
+	out = put(out, order.quantity, Swap);
+	out = put(out, order.price, Swap);
+	out = put(out, order.limit, Swap);
+	std::memcpy(out, order.symbol, sizeof(order.symbol));
+	out += sizeof(order.symbol);
+	out = put(out, order.flags, Swap);
+	return put(out, order.side, false);
+}
+
+template<bool Swap>
+const unsigned char* decode_by_hand(Order& order, const unsigned char* in)
+{
+	in = get(in, order.id, Swap);
+	in = get(in, order.quantity, Swap);
+	in = get(in, order.price, Swap);
+	in = get(in, order.limit, Swap);
+	std::memcpy(order.symbol, in, sizeof(order.symbol));
+	in += sizeof(order.symbol);
+	in = get(in, order.flags, Swap);
+	return get(in, order.side, false);
+}
+
+void report_rate(const char* group, const char* name, double ns_per_message)
+{
+	std::printf("%-24s %-26s %8zu %10.3f GB/s\n", group, name, wire, wire / ns_per_message);
+}
+
+template<typename Order_, bool Swap>
+void run(const char* group, Order_ order)
+{
+	constexpr size_t count = 4096;
+	std::vector<Order> orders(count), decoded(count);
+	for (size_t i = 0; i < count; ++i)
+		orders[i] = Order{ i, static_cast<std::uint32_t>(i * 3), static_cast<std::uint32_t>(i * 7), i * 0.25, "SYMBOL", 0x8001, static_cast<std::uint8_t>(i & 1) };
+	std::vector<unsigned char> buffer(count * wire);
+
+	report_rate(group, "Fields::encode", STBench::measure(count, [&] {
+		unsigned char* out = buffer.data();
+		for (const Order& o : orders)
+			out = OrderFields::encode(o, out, order);
+		STBench::do_not_optimize(buffer.data());
+	}));
+	report_rate(group, "encode field by field", STBench::measure(count, [&] {
+		unsigned char* out = buffer.data();
+		for (const Order& o : orders)
+			out = encode_by_hand<Swap>(o, out);
+		STBench::do_not_optimize(buffer.data());
+	}));
+	report_rate(group, "Fields::decode", STBench::measure(count, [&] {
+		const unsigned char* in = buffer.data();
+		for (Order& o : decoded)
+			in = OrderFields::decode(o, in, order);
+		STBench::do_not_optimize(decoded.data());
+	}));
+	report_rate(group, "decode field by field", STBench::measure(count, [&] {
+		const unsigned char* in = buffer.data();
+		for (Order& o : decoded)
+			in = decode_by_hand<Swap>(o, in);
+		STBench::do_not_optimize(decoded.data());
+	}));
+	report_rate(group, "Fields::view, one member", STBench::measure(count, [&] {
+		std::uint64_t sum = 0;
+		for (size_t i = 0; i < count; ++i)
+			sum += OrderFields::view(buffer.data() + i * wire, order)[IntegralConstant<size_t, 2>{}];
+		STBench::do_not_optimize(sum);
+	}));
+}
+
+int main()
+{
+	run<LittleEndianTag, !std::is_same<NativeEndianTag, LittleEndianTag>::value>("little endian", little_endian);
+	run<BigEndianTag, !std::is_same<NativeEndianTag, BigEndianTag>::value>("big endian", big_endian);
+}
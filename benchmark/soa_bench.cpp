@@ -0,0 +1,78 @@
+// Hot loop over one field of a million records: std::vector of structs against soa_vector columns.
+#include "simpletemplate.hpp"
+#include "runtime_bench.hpp"
+
+#include <array>
+
+using namespace ST;
+
+using Name = std::array<char, 40>;
+
+struct Record
+{
+	double x, y, z;
+	int id;
+	Name name;
+};
+
+using Columns = List<double, double, double, int, Name>;
+
+// Rows of a const vector cannot be assigned; rows of a mutable one assign element-wise
+static_assert(!std::is_copy_assignable<soa_vector<Columns>::const_reference>::value, "const rows are assignable");
+static_assert(std::is_assignable<soa_vector<Columns>::reference, soa_vector<Columns>::const_reference>::value, "rows are not assignable");
+static_assert(std::is_convertible<soa_vector<Columns>::iterator, soa_vector<Columns>::const_iterator>::value, "iterator does not convert to const_iterator");
+static_assert(!std::is_constructible<soa_vector<Columns>::iterator, soa_vector<Columns>::const_iterator>::value, "const_iterator converts to iterator");
+
+int main()
+{
+	constexpr size_t rows = 1 << 20;
+
+	std::vector<Record> aos;
+	soa_vector<Columns> soa;
+	for (size_t i = 0; i < rows; ++i)
+	{
+		const double value = static_cast<double>(i % 1000);
+		aos.push_back({ value, value, value, static_cast<int>(i), Name{} });
+		soa.push_back(value, value, value, static_cast<int>(i), Name{});
+	}
+
+	const double aos_sum = STBench::measure(rows, [&] {
+		double sum = 0;
+		for (const Record& record : aos)
+			sum += record.x;
+		STBench::do_not_optimize(sum);
+	});
+	STBench::report("soa_vector", "sum x (structs)", rows, aos_sum);
+
+	const double soa_sum = STBench::measure(rows, [&] {
+		double sum = 0;
+		for (double x : soa.column(0_c))
+			sum += x;
+		STBench::do_not_optimize(sum);
+	});
+	STBench::report("soa_vector", "sum x (column)", rows, soa_sum);
+
+	const double aos_scale = STBench::measure(rows, [&] {
+		for (Record& record : aos)
+			record.y = record.x * 2 + record.y;
+		STBench::do_not_optimize(aos.front());
+	});
+	STBench::report("soa_vector", "y = 2x + y (structs)", rows, aos_scale);
+
+	const double soa_scale = STBench::measure(rows, [&] {
+		const auto x = soa.column(0_c);
+		const auto y = soa.column(1_c);
+		for (size_t i = 0; i < rows; ++i)
+			y[i] = x[i] * 2 + y[i];
+		STBench::do_not_optimize(y[0]);
+	});
+	STBench::report("soa_vector", "y = 2x + y (column)", rows, soa_scale);
+
+	const double soa_rows = STBench::measure(rows, [&] {
+		double sum = 0;
+		for (auto row : soa)
+			sum += row[0_c];
+		STBench::do_not_optimize(sum);
+	});
+	STBench::report("soa_vector", "sum x (row proxies)", rows, soa_rows);
+}
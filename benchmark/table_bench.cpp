@@ -0,0 +1,84 @@
+// 64K-entry lookup tables: a 16-bit popcount table from make_table, stored as std::uint8_t with minimal_element
+// and as int, against the same table filled by a loop at startup, and a 256x256 saturating add table. Lookups
+// use random keys. The startup case is what the constexpr tables save, since they are in read-only data.
+#include "simpletemplate.hpp"
+#include "runtime_bench.hpp"
+
+using namespace ST;
+
+struct Popcount
+{
+	constexpr int operator()(size_t i) const
+	{
+		int count = 0;
+		for (; i != 0; i &= i - 1)
+			++count;
+		return count;
+	}
+};
+
+struct SaturatingAdd
+{
+	constexpr unsigned operator()(size_t a, size_t b) const
+	{
+		return a + b > 255 ? 255u : static_cast<unsigned>(a + b);
+	}
+};
+
+constexpr auto popcount_wide = make_table<1 << 16>(Popcount{});
+constexpr auto popcount_small = make_table<1 << 16>(Popcount{}, minimal_element);
+constexpr auto saturating_add = make_table<256, 256>(SaturatingAdd{}, minimal_element);
+static_assert(sizeof(popcount_small) == 1 << 16, "minimal_element should store bytes");
+static_assert(sizeof(saturating_add) == 1 << 16, "minimal_element should store bytes");
+
+int main()
+{
+	constexpr size_t count = 1 << 16;
+	constexpr size_t lookups = 1 << 20;
+	const std::vector<size_t> keys = STBench::random_indices(lookups, count);
+
+	static std::array<int, count> filled;
+	STBench::report("startup", "fill loop (int)", count, STBench::measure(count, [&] {
+		for (size_t i = 0; i < count; ++i)
+			filled[i] = Popcount{}(i);
+		STBench::do_not_optimize(filled);
+	}));
+
+	STBench::report("popcount16", "make_table minimal (u8)", lookups, STBench::measure(lookups, [&] {
+		size_t sum = 0;
+		for (size_t key : keys)
+			sum += popcount_small[key];
+		STBench::do_not_optimize(sum);
+	}));
+	STBench::report("popcount16", "make_table (int)", lookups, STBench::measure(lookups, [&] {
+		size_t sum = 0;
+		for (size_t key : keys)
+			sum += popcount_wide[key];
+		STBench::do_not_optimize(sum);
+	}));
+	STBench::report("popcount16", "filled at startup (int)", lookups, STBench::measure(lookups, [&] {
+		size_t sum = 0;
+		for (size_t key : keys)
+			sum += filled[key];
+		STBench::do_not_optimize(sum);
+	}));
+	STBench::report("popcount16", "computed", lookups, STBench::measure(lookups, [&] {
+		size_t sum = 0;
+		for (size_t key : keys)
+			sum += Popcount{}(key);
+		STBench::do_not_optimize(sum);
+	}));
+
+	STBench::report("saturating add", "make_table<256, 256> (u8)", lookups, STBench::measure(lookups, [&] {
+		size_t sum = 0;
+		for (size_t key : keys)
+			sum += saturating_add[key >> 8][key & 255];
+		STBench::do_not_optimize(sum);
+	}));
+	STBench::report("saturating add", "computed", lookups, STBench::measure(lookups, [&] {
+		size_t sum = 0;
+		for (size_t key : keys)
+			sum += SaturatingAdd{}(key >> 8, key & 255);
+		STBench::do_not_optimize(sum);
+	}));
+}
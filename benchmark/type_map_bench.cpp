@@ -0,0 +1,79 @@
+// Runtime lookup by type hash: type_map's compile-time perfect hash against std::unordered_map keyed by
+// the same hashes and by std::type_index. Keys are drawn at random from N message types.
+#include "simpletemplate.hpp"
+#include "runtime_bench.hpp"
+
+#include <typeindex>
+#include <unordered_map>
+
+using namespace ST;
+
+template<size_t N>
+struct Message {};
+
+template<typename Indices>
+struct MessagesOf;
+
+template<size_t... Ns>
+struct MessagesOf<std::index_sequence<Ns...>>
+{
+	using Type = List<Message<Ns>...>;
+};
+
+template<size_t N>
+using Messages = typename MessagesOf<std::make_index_sequence<N>>::Type;
+
+template<typename... Ts>
+void run(List<Ts...>)
+{
+	constexpr size_t operations = 1 << 20;
+	constexpr size_t n = sizeof...(Ts);
+
+	const std::uint64_t hashes[] = { static_cast<std::uint64_t>(Tag<Ts>::hash())... };
+	const std::type_index types[] = { std::type_index(typeid(Ts))... };
+
+	type_map<List<Ts...>, std::uint64_t> map;
+	std::unordered_map<std::uint64_t, std::uint64_t> by_hash;
+	std::unordered_map<std::type_index, std::uint64_t> by_type;
+	for (size_t i = 0; i < n; ++i)
+	{
+		by_hash[hashes[i]] = i;
+		by_type[types[i]] = i;
+	}
+	std::uint64_t* value = map.begin();
+	for (size_t i = 0; i < n; ++i)
+		value[i] = i;
+
+	const std::vector<size_t> keys = STBench::random_indices(operations, n);
+
+	const double perfect = STBench::measure(operations, [&] {
+		std::uint64_t sum = 0;
+		for (size_t k : keys)
+			sum += *map.find(hashes[k]);
+		STBench::do_not_optimize(sum);
+	});
+	STBench::report("lookup by type hash", "type_map::find", n, perfect);
+
+	const double hashed = STBench::measure(operations, [&] {
+		std::uint64_t sum = 0;
+		for (size_t k : keys)
+			sum += by_hash.find(hashes[k])->second;
+		STBench::do_not_optimize(sum);
+	});
+	STBench::report("lookup by type hash", "unordered_map<uint64_t>", n, hashed);
+
+	const double indexed = STBench::measure(operations, [&] {
+		std::uint64_t sum = 0;
+		for (size_t k : keys)
+			sum += by_type.find(types[k])->second;
+		STBench::do_not_optimize(sum);
+	});
+	STBench::report("lookup by type hash", "unordered_map<type_index>", n, indexed);
+}
+
+int main()
+{
+	run(Messages<16>{});
+	run(Messages<256>{});
+	run(Messages<2048>{});
+}
@@ -0,0 +1,134 @@
+// Footprint, visit throughput and copy cost of ST::variant against std::variant, for scalar alternatives
+// (trivial copies) and for a list holding a std::string. Alternatives are random so the visit mispredicts.
+#include "simpletemplate.hpp"
+#include "runtime_bench.hpp"
+
+#include <memory>
+#include <string>
+#include <variant>
+
+using namespace ST;
+
+enum class Color : unsigned char { red, green, blue };
+
+template<size_t N>
+struct Byte { char value; };
+
+template<typename Indices>
+struct BytesOf;
+
+template<size_t... Ns>
+struct BytesOf<std::index_sequence<Ns...>>
+{
+	using Type = List<Byte<Ns>...>;
+};
+
+// Copy members exist only when every alternative can be copied
+static_assert(!std::is_copy_constructible<variant<List<int, std::unique_ptr<int>>>>::value, "variant of a move-only type is copyable");
+static_assert(!std::is_copy_assignable<variant<List<int, std::unique_ptr<int>>>>::value, "variant of a move-only type is copyable");
+static_assert(std::is_nothrow_move_constructible<variant<List<int, std::unique_ptr<int>>>>::value, "variant of a move-only type is not movable");
+static_assert(std::is_copy_assignable<variant<List<int, std::string>>>::value, "variant of copyable types is not copyable");
+
+// An alternative without move assignment, such as one with a const member, is replaced by its move constructor
+struct ConstMember
+{
+	const int value;
+	explicit ConstMember(int v) : value(v) {}
+	ConstMember(ConstMember&& other) noexcept : value(other.value) {}
+};
+using ConstMemberVariant = variant<List<ConstMember, std::string>>;
+static_assert(std::is_nothrow_move_assignable<ConstMemberVariant>::value, "variant of a type without move assignment is not movable");
+static_assert(!std::is_copy_assignable<ConstMemberVariant>::value, "variant of a type without copy assignment is copyable");
+inline void move_assign_const_member(ConstMemberVariant& a, ConstMemberVariant& b) { a = std::move(b); }
+
+// Construction and emplace from a tag require one of the alternatives, constructible from the arguments
+static_assert(!std::is_constructible<variant<List<int, double>>, Tag<char>, char>::value, "variant is constructible as a type outside the list");
+static_assert(!std::is_constructible<variant<List<int, std::string>>, Tag<std::string>, int*>::value, "variant is constructible from wrong arguments");
+
+template<typename... Ts>
+constexpr auto with_std(List<Ts...>) { return Tag<std::variant<Ts...>>{}; }
+
+template<typename... Ts>
+constexpr auto with_st(List<Ts...>) { return Tag<variant<List<Ts...>>>{}; }
+
+template<typename L>
+void footprint(const char* group, L l)
+{
+	std::printf("%-24s %-26s %8zu %10zu bytes\n", group, "std::variant", size_t(L::length), sizeof(TOTYPE(with_std(l))));
+	std::printf("%-24s %-26s %8zu %10zu bytes\n", group, "variant", size_t(L::length), sizeof(TOTYPE(with_st(l))));
+}
+
+struct Sum
+{
+	std::uint64_t operator()(int x) const { return static_cast<std::uint64_t>(x); }
+	std::uint64_t operator()(double x) const { return static_cast<std::uint64_t>(x); }
+	std::uint64_t operator()(Color x) const { return static_cast<std::uint64_t>(x); }
+	std::uint64_t operator()(const int* x) const { return reinterpret_cast<std::uintptr_t>(x) & 0xFF; }
+	std::uint64_t operator()(const std::string& x) const { return x.size(); }
+};
+
+template<typename Variant, typename Make, typename Visit>
+void run(const char* group, const char* name, Make make, Visit visit)
+{
+	constexpr size_t count = 1 << 16;
+
+	std::vector<Variant> values;
+	values.reserve(count);
+	for (size_t index : STBench::random_indices(count, 4))
+		values.push_back(make(index));
+
+	const double visits = STBench::measure(count, [&] {
+		std::uint64_t sum = 0;
+		for (const Variant& value : values)
+			sum += visit(value);
+		STBench::do_not_optimize(sum);
+	});
+	STBench::report(group, (std::string(name) + " visit").c_str(), count, visits);
+
+	std::vector<Variant> copies(values);
+	const double copy = STBench::measure(count, [&] {
+		copies = values;
+		STBench::do_not_optimize(copies.data());
+	});
+	STBench::report(group, (std::string(name) + " copy").c_str(), count, copy);
+}
+
+int main()
+{
+	footprint("footprint: 4 scalars", List<int, double, Color, const int*>{});
+	footprint("footprint: 3 bytes", List<char, bool, Color>{});
+	footprint("footprint: 256 x 1 byte", typename BytesOf<std::make_index_sequence<256>>::Type{});
+
+	static const int target = 0;
+	using Scalars = List<int, double, Color, const int*>;
+	const auto make_scalar = [](size_t index) -> variant<Scalars> {
+		switch (index)
+		{
+		case 0: return 7;
+		case 1: return 2.5;
+		case 2: return Color::blue;
+		default: return &target;
+		}
+	};
+	run<std::variant<int, double, Color, const int*>>("4 scalars", "std::variant",
+		[&](size_t index) { return make_scalar(index).visit([](auto x) { return std::variant<int, double, Color, const int*>(x); }); },
+		[](const auto& value) { return std::visit(Sum{}, value); });
+	run<variant<Scalars>>("4 scalars", "variant", make_scalar,
+		[](const auto& value) { return value.visit(Sum{}); });
+
+	using Mixed = List<int, double, Color, std::string>;
+	const auto make_mixed = [](size_t index) -> variant<Mixed> {
+		switch (index)
+		{
+		case 0: return 7;
+		case 1: return 2.5;
+		case 2: return Color::blue;
+		default: return std::string(32, 'x');
+		}
+	};
+	run<std::variant<int, double, Color, std::string>>("with std::string", "std::variant",
+		[&](size_t index) { return make_mixed(index).visit([](const auto& x) { return std::variant<int, double, Color, std::string>(x); }); },
+		[](const auto& value) { return std::visit(Sum{}, value); });
+	run<variant<Mixed>>("with std::string", "variant", make_mixed,
+		[](const auto& value) { return value.visit(Sum{}); });
+}
@@ -0,0 +1,170 @@
+#pragma once
+// relocate, copy_n and fill_n, by type category
+#include "tag.hpp"
+
+#include <new>
+#include <cstring>
+
+namespace ST
+{
+	/*************************************************************************************************************/
+	/* Bulk operations */
+	// relocate, copy_n and fill_n pick an implementation from tag<T>.category() and size. Scalars are moved with memmove
+	// and filled 64 bytes at a time. Classes that specialize TriviallyRelocatable are relocated with memmove. All other
+	// types are handled one element at a time.
+
+	// Specialize as BoolConstantTrue for classes whose objects may be moved to another address with memcpy, without running the
+	// move constructor and destructor, e.g. most handles and containers that do not point into themselves
+	template<typename T>
+	struct TriviallyRelocatable : BoolConstant<std::is_trivially_copyable<T>::value> {};
+
+	// Moves n objects from first to the uninitialized dest and ends their lifetime at first. The ranges may overlap,
+	// as when compacting a buffer. Returns dest + n.
+	template<typename T>
+	T* relocate(T* first, size_t n, T* dest);
+
+	// Assigns n objects from first to dest, which must not overlap. Returns dest + n.
+	template<typename T>
+	T* copy_n(const T* first, size_t n, T* dest);
+
+	// Assigns value, converted to T, to n objects at dest. Returns dest + n.
+	template<typename T, typename U>
+	T* fill_n(T* dest, size_t n, const U& value);
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Bulk operations **/
+
+		struct ScalarBulkTag {};
+		struct RelocatableBulkTag {};
+		struct ElementwiseBulkTag {};
+
+		template<typename T>
+		using BulkKind =
+			std::conditional_t<is_scalar_category(TypeCategory<T>{}), ScalarBulkTag,
+			std::conditional_t<static_cast<bool>(TriviallyRelocatable<T>{}), RelocatableBulkTag, ElementwiseBulkTag>>;
+
+		template<typename T>
+		void relocate_bulk(T* first, size_t n, T* dest, ScalarBulkTag)
+		{
+			std::memmove(static_cast<void*>(dest), static_cast<const void*>(first), n * sizeof(T));
+		}
+
+		template<typename T>
+		void relocate_bulk(T* first, size_t n, T* dest, RelocatableBulkTag)
+		{
+			std::memmove(static_cast<void*>(dest), static_cast<const void*>(first), n * sizeof(T));
+		}
+
+		// Front to back when moving down, back to front when moving up, so overlapping sources are read before being overwritten
+		template<typename T>
+		void relocate_bulk(T* first, size_t n, T* dest, ElementwiseBulkTag)
+		{
+			static_assert(std::is_nothrow_move_constructible<T>::value, "relocate: type must be nothrow move constructible");
+			if (dest == first)
+				return;
+			if (dest < first)
+			{
+				for (size_t i = 0; i < n; ++i)
+				{
+					::new (static_cast<void*>(dest + i)) T(std::move(first[i]));
+					first[i].~T();
+				}
+			}
+			else
+			{
+				for (size_t i = n; i-- > 0;)
+				{
+					::new (static_cast<void*>(dest + i)) T(std::move(first[i]));
+					first[i].~T();
+				}
+			}
+		}
+
+		template<typename T>
+		void copy_bulk(const T* first, size_t n, T* dest, ScalarBulkTag)
+		{
+			std::memmove(static_cast<void*>(dest), static_cast<const void*>(first), n * sizeof(T));
+		}
+
+		template<typename T, typename Kind>
+		void copy_bulk(const T* first, size_t n, T* dest, Kind)
+		{
+			for (size_t i = 0; i < n; ++i)
+				dest[i] = first[i];
+		}
+
+		template<typename T>
+		void fill_scalar(T* dest, size_t n, const T& value, BoolConstantTrue /*one byte*/)
+		{
+			unsigned char byte;
+			std::memcpy(&byte, &value, 1);
+			std::memset(static_cast<void*>(dest), byte, n);
+		}
+
+		// A cache line of copies of value, stored with fixed size memcpy that compilers lower to vector stores
+		template<typename T>
+		void fill_scalar(T* dest, size_t n, const T& value, BoolConstantFalse /*one byte*/)
+		{
+			constexpr size_t lanes = sizeof(T) < 64 ? 64 / sizeof(T) : 1;
+			T block[lanes];
+			for (size_t i = 0; i < lanes; ++i)
+				block[i] = value;
+			for (; n >= lanes; n -= lanes, dest += lanes)
+				std::memcpy(static_cast<void*>(dest), static_cast<const void*>(block), sizeof(block));
+			for (size_t i = 0; i < n; ++i)
+				dest[i] = value;
+		}
+
+		template<typename T>
+		void fill_bulk(T* dest, size_t n, const T& value, ScalarBulkTag)
+		{
+			fill_scalar(dest, n, value, BoolConstant<sizeof(T) == 1>{});
+		}
+
+		template<typename T, typename Kind>
+		void fill_bulk(T* dest, size_t n, const T& value, Kind)
+		{
+			for (size_t i = 0; i < n; ++i)
+				dest[i] = value;
+		}
+
+		/** Bulk operations **/
+
+	} // namespace Details
+
+	/** Bulk operations **/
+
+	template<typename T>
+	T* relocate(T* first, size_t n, T* dest)
+	{
+		Details::relocate_bulk(first, n, dest, Details::BulkKind<T>{});
+		return dest + n;
+	}
+
+	template<typename T>
+	T* copy_n(const T* first, size_t n, T* dest)
+	{
+		Details::copy_bulk(first, n, dest, Details::BulkKind<T>{});
+		return dest + n;
+	}
+
+	// value is converted first, so it may also refer into the destination
+	template<typename T, typename U>
+	T* fill_n(T* dest, size_t n, const U& value)
+	{
+		const T converted = value;
+		Details::fill_bulk(dest, n, converted, Details::BulkKind<T>{});
+		return dest + n;
+	}
+
+	/** Bulk operations **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
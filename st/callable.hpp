@@ -0,0 +1,194 @@
+#pragma once
+// Callable traits: return and parameter types, and the cheapest parameter type
+#include "list.hpp"
+
+namespace ST
+{
+#define POSSIBLE_RETURN(...) auto
+
+	/*************************************************************************************************************/
+	/* Callable traits */
+	// Function types of any qualification, pointers and references to functions,
+	// pointers to member functions and classes with a single non-template operator()
+	template<typename T>
+	constexpr POSSIBLE_RETURN(None, Tag<...>) function_return_type();
+
+	template<typename T>
+	constexpr POSSIBLE_RETURN(None, List<...>) function_parameter_types();
+
+	// The cheapest way to take a T as a parameter: by value when trivially copyable and no larger
+	// than two registers, by const& otherwise. References are kept as they are.
+	template<typename T>
+	constexpr POSSIBLE_RETURN(None, Tag<...>) param_type_of();
+
+	template<typename T>
+	using ParamType = typename decltype(param_type_of<T>())::Type;
+
+#undef POSSIBLE_RETURN
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Function traits **/
+
+		struct NoSignature
+		{
+			using Return = None;
+			using Parameters = None;
+		};
+
+		// Function types of every cv, ref and noexcept qualification; a C-style ellipsis is dropped
+		template<typename F>
+		struct FunctionSignature;
+
+#define _ST_FUNCTION_SIGNATURE(QUALIFIERS)						\
+	template<typename R, typename... A>							\
+	struct FunctionSignature<R(A...) QUALIFIERS>				\
+	{															\
+		using Return = Tag<R>;									\
+		using Parameters = List<A...>;							\
+	};															\
+	template<typename R, typename... A>							\
+	struct FunctionSignature<R(A..., ...) QUALIFIERS>			\
+	{															\
+		using Return = Tag<R>;									\
+		using Parameters = List<A...>;							\
+	};
+
+#define _ST_FUNCTION_SIGNATURE_REF(CV, NOEXCEPT)				\
+	_ST_FUNCTION_SIGNATURE(CV NOEXCEPT)							\
+	_ST_FUNCTION_SIGNATURE(CV & NOEXCEPT)						\
+	_ST_FUNCTION_SIGNATURE(CV && NOEXCEPT)
+
+#define _ST_FUNCTION_SIGNATURE_CV(NOEXCEPT)						\
+	_ST_FUNCTION_SIGNATURE_REF(, NOEXCEPT)						\
+	_ST_FUNCTION_SIGNATURE_REF(const, NOEXCEPT)					\
+	_ST_FUNCTION_SIGNATURE_REF(volatile, NOEXCEPT)				\
+	_ST_FUNCTION_SIGNATURE_REF(const volatile, NOEXCEPT)
+
+		_ST_FUNCTION_SIGNATURE_CV()
+#if defined(__cpp_noexcept_function_type)
+		// noexcept is part of the type since C++17
+		_ST_FUNCTION_SIGNATURE_CV(noexcept)
+#endif
+
+#undef _ST_FUNCTION_SIGNATURE_CV
+#undef _ST_FUNCTION_SIGNATURE_REF
+#undef _ST_FUNCTION_SIGNATURE
+
+		template<typename T, typename = TypeCategory<T>>
+		struct FunctionTypeImpl : NoSignature {};
+
+		template<typename T>
+		struct FunctionTypeImpl<T, FunctionTag> : FunctionSignature<T> {};
+
+		// Only pointers to functions; a pointer to a function object is not callable
+		template<typename T>
+		struct FunctionTypeImpl<T, PointerTag>
+			: std::conditional_t<std::is_function<std::remove_pointer_t<T>>::value,
+				FunctionSignature<std::remove_pointer_t<T>>, NoSignature> {};
+
+		template<typename T>
+		struct FunctionTypeImpl<T, LValueReferenceTag> : FunctionTypeImpl<std::remove_reference_t<T>> {};
+
+		template<typename T>
+		struct FunctionTypeImpl<T, RValueReferenceTag> : FunctionTypeImpl<std::remove_reference_t<T>> {};
+
+		template<typename T>
+		struct MemberFunctionSignature;
+
+		template<typename M, typename C>
+		struct MemberFunctionSignature<M C::*> : FunctionSignature<M> {};
+
+		template<typename T>
+		struct FunctionTypeImpl<T, PointerToMemberFunctionTag> : MemberFunctionSignature<std::remove_cv_t<T>> {};
+
+		// Lambdas and function objects, unless operator() is overloaded or a template
+		template<typename T, typename = void>
+		struct CallOperatorImpl : NoSignature {};
+
+		template<typename T>
+		struct CallOperatorImpl<T, decltype(void(&T::operator()))> : FunctionTypeImpl<decltype(&T::operator())> {};
+
+		template<typename T>
+		struct FunctionTypeImpl<T, ClassTag> : CallOperatorImpl<std::remove_cv_t<T>> {};
+
+		template<typename T, typename = TypeCategory<T>>
+		struct ParamTypeImpl
+		{
+			using Type = Tag<std::conditional_t<
+				std::is_trivially_copyable<T>::value && sizeof(T) <= 2 * sizeof(void*),
+				std::remove_cv_t<T>, const T&>>;
+		};
+
+		template<typename T>
+		struct ParamTypeImpl<T, VoidTag> { using Type = None; };
+
+		// A function is passed as the reference it would otherwise decay from
+		template<typename T>
+		struct ParamTypeImpl<T, FunctionTag> { using Type = Tag<T&>; };
+
+		template<typename T>
+		struct ParamTypeImpl<T, ArrayTag> { using Type = Tag<const T&>; };
+
+		template<typename T>
+		struct ParamTypeImpl<T, LValueReferenceTag> { using Type = Tag<T>; };
+
+		template<typename T>
+		struct ParamTypeImpl<T, RValueReferenceTag> { using Type = Tag<T>; };
+
+		/** Function traits **/
+
+	} // namespace Details
+
+	/** Free functions **/
+
+	template<typename T>
+	constexpr auto function_return_type()
+	{
+		return typename Details::FunctionTypeImpl<T>::Return{};
+	}
+
+	template<typename T>
+	constexpr auto function_parameter_types()
+	{
+		return typename Details::FunctionTypeImpl<T>::Parameters{};
+	}
+
+	template<typename T>
+	constexpr auto param_type_of()
+	{
+		return typename Details::ParamTypeImpl<T>::Type{};
+	}
+
+	/** Free functions **/
+
+	/** struct Tag **/
+
+	template<typename T> constexpr auto Tag<T>::return_type()
+	{
+		_ST_INSTRUMENT("tag.return_type", 0);
+		return function_return_type<T>();
+	}
+
+	template<typename T> constexpr auto Tag<T>::parameter_types()
+	{
+		_ST_INSTRUMENT("tag.parameter_types", 0);
+		return function_parameter_types<T>();
+	}
+
+	template<typename T> constexpr auto Tag<T>::param_type()
+	{
+		_ST_INSTRUMENT("tag.param_type", 0);
+		return param_type_of<T>();
+	}
+
+	/** struct Tag **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
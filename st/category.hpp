@@ -0,0 +1,251 @@
+#pragma once
+// Type categories: one tag type per primary category of <type_traits>
+#include "integral.hpp"
+
+namespace ST
+{
+	/*************************************************************************************************************/
+	/* Type Categories */
+
+	template<typename T>
+	struct TypeCategoryTagBase
+	{
+		constexpr BoolConstantTrue operator==(TypeCategoryTagBase<T>) const { return {}; }
+		constexpr BoolConstantFalse operator!=(TypeCategoryTagBase<T>) const { return {}; }
+
+		template<typename U>
+		constexpr BoolConstantFalse operator==(TypeCategoryTagBase<U>) const { return {}; }
+
+		template<typename U>
+		constexpr BoolConstantTrue operator!=(TypeCategoryTagBase<U>) const { return {}; }
+	};
+
+	struct VoidTag : TypeCategoryTagBase<VoidTag> {};
+	_ST_INLINE_VAR constexpr VoidTag void_tag = {};
+
+	struct NullptrTag : TypeCategoryTagBase<NullptrTag> {};
+	_ST_INLINE_VAR constexpr NullptrTag nullptr_tag = {};
+
+	struct IntegralTag : TypeCategoryTagBase<IntegralTag> {};
+	_ST_INLINE_VAR constexpr IntegralTag integral_tag = {};
+
+	struct FloatingPointTag : TypeCategoryTagBase<FloatingPointTag> {};
+	_ST_INLINE_VAR constexpr FloatingPointTag floating_point_tag = {};
+
+	struct ArrayTag : TypeCategoryTagBase<ArrayTag> {};
+	_ST_INLINE_VAR constexpr ArrayTag array_tag = {};
+
+	struct EnumTag : TypeCategoryTagBase<EnumTag> {};
+	_ST_INLINE_VAR constexpr EnumTag enum_tag = {};
+
+	struct UnionTag : TypeCategoryTagBase<UnionTag> {};
+	_ST_INLINE_VAR constexpr UnionTag union_tag = {};
+
+	struct ClassTag : TypeCategoryTagBase<ClassTag> {};
+	_ST_INLINE_VAR constexpr ClassTag class_tag = {};
+
+	struct FunctionTag : TypeCategoryTagBase<FunctionTag> {};
+	_ST_INLINE_VAR constexpr FunctionTag function_tag = {};
+
+	struct PointerTag : TypeCategoryTagBase<PointerTag> {};
+	_ST_INLINE_VAR constexpr PointerTag pointer_tag = {};
+
+	struct ReferenceTag : TypeCategoryTagBase<ReferenceTag> {};
+	_ST_INLINE_VAR constexpr ReferenceTag reference_tag = {};
+
+	struct LValueReferenceTag : ReferenceTag {};
+	_ST_INLINE_VAR constexpr LValueReferenceTag lvalue_reference_tag = {};
+
+	struct RValueReferenceTag : ReferenceTag {};
+	_ST_INLINE_VAR constexpr RValueReferenceTag rvalue_reference_tag = {};
+
+	struct PointerToMemberObjectTag : TypeCategoryTagBase<PointerToMemberObjectTag> {};
+	_ST_INLINE_VAR constexpr PointerToMemberObjectTag pointer_to_member_object_tag = {};
+
+	struct PointerToMemberFunctionTag : TypeCategoryTagBase<PointerToMemberFunctionTag> {};
+	_ST_INLINE_VAR constexpr PointerToMemberFunctionTag pointer_to_member_function_tag = {};
+
+	template<typename T>
+	constexpr auto type_category();
+
+	template<typename T>
+	using TypeCategory = decltype(type_category<T>());
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Type categories **/
+
+		// Class, enum and union types are told apart by compiler intrinsics, which the big three all provide.
+		// Everything else is matched structurally after dropping cv-qualifiers, so any type costs at most
+		// three instantiations and no trait is evaluated on the way to a class type.
+#if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+#	define _ST_IS_CLASS(T) __is_class(T)
+#	define _ST_IS_ENUM(T) __is_enum(T)
+#	define _ST_IS_UNION(T) __is_union(T)
+#else
+#	define _ST_IS_CLASS(T) std::is_class<T>::value
+#	define _ST_IS_ENUM(T) std::is_enum<T>::value
+#	define _ST_IS_UNION(T) std::is_union<T>::value
+#endif
+
+		enum class UserDefinedKind { None, Class, Enum, Union };
+
+		template<typename T>
+		struct StructuralCategoryImpl
+		{
+			// Function types of any qualification, and nothing else, are left here
+			static_assert(std::is_function<T>::value, "type_category: unsupported type");
+			using Category = FunctionTag;
+		};
+
+#define _ST_SPECIALIZE_TAG(T, TAG)		\
+	template<>							\
+	struct StructuralCategoryImpl<T>	\
+	{									\
+		using Category = TAG;			\
+	};
+
+#define _ST_SPECIALIZE_INTEGRAL_TAG_SIGN(T)			\
+	_ST_SPECIALIZE_TAG(signed T, IntegralTag);		\
+	_ST_SPECIALIZE_TAG(unsigned T, IntegralTag);
+
+		//void type
+		_ST_SPECIALIZE_TAG(void, VoidTag);
+		//nullptr type
+		_ST_SPECIALIZE_TAG(std::nullptr_t, NullptrTag);
+
+		//Integral types
+		_ST_SPECIALIZE_TAG(bool, IntegralTag);
+		_ST_SPECIALIZE_TAG(char, IntegralTag);
+		_ST_SPECIALIZE_TAG(char16_t, IntegralTag);
+		_ST_SPECIALIZE_TAG(char32_t, IntegralTag);
+		_ST_SPECIALIZE_TAG(wchar_t, IntegralTag);
+#if defined(__cpp_char8_t)
+		_ST_SPECIALIZE_TAG(char8_t, IntegralTag);
+#endif
+		_ST_SPECIALIZE_INTEGRAL_TAG_SIGN(char);
+		_ST_SPECIALIZE_INTEGRAL_TAG_SIGN(short);
+		_ST_SPECIALIZE_INTEGRAL_TAG_SIGN(int);
+		_ST_SPECIALIZE_INTEGRAL_TAG_SIGN(long);
+		_ST_SPECIALIZE_INTEGRAL_TAG_SIGN(long long);
+#if defined(__SIZEOF_INT128__)
+		_ST_SPECIALIZE_TAG(WidestInt, IntegralTag);
+		_ST_SPECIALIZE_TAG(WidestUInt, IntegralTag);
+#endif
+
+		//Floating point types
+		_ST_SPECIALIZE_TAG(float, FloatingPointTag);
+		_ST_SPECIALIZE_TAG(double, FloatingPointTag);
+		_ST_SPECIALIZE_TAG(long double, FloatingPointTag);
+
+		//Array types
+		template<typename T>
+		struct StructuralCategoryImpl<T[]>
+		{
+			using Category = ArrayTag;
+		};
+
+		template<typename T, size_t N>
+		struct StructuralCategoryImpl<T[N]>
+		{
+			using Category = ArrayTag;
+		};
+
+		//Pointer types
+		template<typename T>
+		struct StructuralCategoryImpl<T*>
+		{
+			using Category = PointerTag;
+		};
+
+		//Reference types
+		template<typename T>
+		struct StructuralCategoryImpl<T&>
+		{
+			using Category = LValueReferenceTag; //convertible to ReferenceTag
+		};
+
+		template<typename T>
+		struct StructuralCategoryImpl<T&&>
+		{
+			using Category = RValueReferenceTag; //convertible to ReferenceTag
+		};
+
+		//Pointer to member types
+		template<typename T, typename C>
+		struct StructuralCategoryImpl<T C::*>
+		{
+			using Category = std::conditional_t<std::is_function<T>::value, PointerToMemberFunctionTag, PointerToMemberObjectTag>;
+		};
+
+		template<typename T, UserDefinedKind =
+			_ST_IS_CLASS(T) ? UserDefinedKind::Class :
+			_ST_IS_ENUM(T) ? UserDefinedKind::Enum :
+			_ST_IS_UNION(T) ? UserDefinedKind::Union :
+			UserDefinedKind::None>
+		struct TypeCategoryImpl
+		{
+			_ST_INSTRUMENT("type_category", 0);
+			using Category = typename StructuralCategoryImpl<std::remove_cv_t<T>>::Category;
+		};
+
+		template<typename T>
+		struct TypeCategoryImpl<T, UserDefinedKind::Class>
+		{
+			_ST_INSTRUMENT("type_category", 0);
+			using Category = ClassTag;
+		};
+
+		template<typename T>
+		struct TypeCategoryImpl<T, UserDefinedKind::Enum>
+		{
+			_ST_INSTRUMENT("type_category", 0);
+			using Category = EnumTag;
+		};
+
+		template<typename T>
+		struct TypeCategoryImpl<T, UserDefinedKind::Union>
+		{
+			_ST_INSTRUMENT("type_category", 0);
+			using Category = UnionTag;
+		};
+
+#undef _ST_SPECIALIZE_TAG
+#undef _ST_SPECIALIZE_INTEGRAL_TAG_SIGN
+#undef _ST_IS_CLASS
+#undef _ST_IS_ENUM
+#undef _ST_IS_UNION
+
+		// Categories whose copy, move and destruction are always trivial
+		template<typename Category>
+		constexpr bool is_scalar_category(TypeCategoryTagBase<Category>) { return false; }
+		constexpr bool is_scalar_category(NullptrTag) { return true; }
+		constexpr bool is_scalar_category(IntegralTag) { return true; }
+		constexpr bool is_scalar_category(FloatingPointTag) { return true; }
+		constexpr bool is_scalar_category(EnumTag) { return true; }
+		constexpr bool is_scalar_category(PointerTag) { return true; }
+		constexpr bool is_scalar_category(PointerToMemberObjectTag) { return true; }
+		constexpr bool is_scalar_category(PointerToMemberFunctionTag) { return true; }
+
+		/** Type categories **/
+
+	} // namespace Details
+
+	/** Type categories **/
+
+	template<typename T>
+	constexpr auto type_category()
+	{
+		return typename Details::TypeCategoryImpl<T>::Category{};
+	}
+
+	/** Type categories **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
@@ -0,0 +1,149 @@
+#pragma once
+// dispatch: calls a function with the type of a list at a runtime index
+#include "list.hpp"
+
+namespace ST
+{
+	/*************************************************************************************************************/
+	/* Runtime dispatch */
+	// Calls f(tag<T>) for the type at a runtime index, which must be less than the length of the list.
+	// f must return the same type for every alternative.
+
+	// One indirect call through a constexpr table of function pointers
+	_ST_INLINE_VAR constexpr struct TableDispatchTag {} table_dispatch = {};
+
+	// Nested switch statements of 32 cases, which compilers lower to jump tables; inlines f for small lists
+	_ST_INLINE_VAR constexpr struct SwitchDispatchTag {} switch_dispatch = {};
+
+	template<typename... Ts, typename F>
+	constexpr decltype(auto) dispatch(List<Ts...>, size_t index, F&& f, TableDispatchTag = table_dispatch);
+
+	template<typename... Ts, typename F>
+	constexpr decltype(auto) dispatch(List<Ts...>, size_t index, F&& f, SwitchDispatchTag);
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Runtime dispatch **/
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#	define _ST_UNREACHABLE() __assume(0)
+#else
+#	define _ST_UNREACHABLE() __builtin_unreachable()
+#endif
+
+		template<typename F, typename... Ts>
+		struct DispatchResult
+		{
+			using Type = decltype(std::declval<F>()(tag<NthTypeOf<0, Ts...>>));
+
+			static_assert(all_same<Type, decltype(std::declval<F>()(tag<Ts>))...>,
+				"dispatch: f must return the same type for every alternative");
+		};
+
+		template<typename R, typename F, typename... Ts>
+		struct DispatchTable
+		{
+			using Entry = R(*)(F&&);
+
+			template<typename T>
+			static constexpr R invoke(F&& f) { return std::forward<F>(f)(tag<T>); }
+
+			static constexpr Entry entries[] = { &invoke<Ts>... };
+		};
+
+		template<typename R, typename F, typename... Ts>
+		constexpr typename DispatchTable<R, F, Ts...>::Entry DispatchTable<R, F, Ts...>::entries[];
+
+		_ST_INLINE_VAR constexpr size_t switch_dispatch_width = 32;
+
+		// Size of the range covered by the outermost switch: the smallest power of the width holding all N alternatives
+		constexpr size_t switch_dispatch_span(size_t n)
+		{
+			size_t span = 1;
+			while (span < n)
+				span *= switch_dispatch_width;
+			return span;
+		}
+
+		enum class SwitchDispatchKind { Unreachable, Leaf, Node };
+
+		template<size_t Begin, size_t Span, size_t N>
+		constexpr SwitchDispatchKind switch_dispatch_kind =
+			Begin >= N ? SwitchDispatchKind::Unreachable : Span == 1 ? SwitchDispatchKind::Leaf : SwitchDispatchKind::Node;
+
+		// Covers the alternatives [Begin, Begin + Span)
+		template<typename R, size_t Begin, size_t Span, typename L, SwitchDispatchKind = switch_dispatch_kind<Begin, Span, static_cast<size_t>(L::length)>>
+		struct SwitchDispatch;
+
+		template<typename R, size_t Begin, size_t Span, typename... Ts>
+		struct SwitchDispatch<R, Begin, Span, List<Ts...>, SwitchDispatchKind::Unreachable>
+		{
+			template<typename F>
+			static constexpr R invoke(size_t, F&&) { _ST_UNREACHABLE(); }
+		};
+
+		template<typename R, size_t Begin, typename... Ts>
+		struct SwitchDispatch<R, Begin, 1, List<Ts...>, SwitchDispatchKind::Leaf>
+		{
+			template<typename F>
+			static constexpr R invoke(size_t, F&& f) { return std::forward<F>(f)(tag<NthTypeOf<Begin, Ts...>>); }
+		};
+
+		template<typename R, size_t Begin, size_t Span, typename... Ts>
+		struct SwitchDispatch<R, Begin, Span, List<Ts...>, SwitchDispatchKind::Node>
+		{
+			static constexpr size_t child_span = Span / switch_dispatch_width;
+
+			template<typename F>
+			static constexpr R invoke(size_t index, F&& f)
+			{
+#define _ST_DISPATCH_CASE(N)	\
+	case (N): return SwitchDispatch<R, Begin + (N) * child_span, child_span, List<Ts...>>::invoke(index, std::forward<F>(f));
+#define _ST_DISPATCH_CASES_4(N)	\
+	_ST_DISPATCH_CASE(N) _ST_DISPATCH_CASE(N + 1) _ST_DISPATCH_CASE(N + 2) _ST_DISPATCH_CASE(N + 3)
+
+				switch ((index - Begin) / child_span)
+				{
+					_ST_DISPATCH_CASES_4(0) _ST_DISPATCH_CASES_4(4) _ST_DISPATCH_CASES_4(8) _ST_DISPATCH_CASES_4(12)
+					_ST_DISPATCH_CASES_4(16) _ST_DISPATCH_CASES_4(20) _ST_DISPATCH_CASES_4(24) _ST_DISPATCH_CASES_4(28)
+					default: _ST_UNREACHABLE();
+				}
+
+#undef _ST_DISPATCH_CASES_4
+#undef _ST_DISPATCH_CASE
+			}
+		};
+
+		/** Runtime dispatch **/
+
+	} // namespace Details
+
+	/** Runtime dispatch **/
+
+	template<typename... Ts, typename F>
+	constexpr decltype(auto) dispatch(List<Ts...>, size_t index, F&& f, TableDispatchTag)
+	{
+		static_assert(sizeof...(Ts) > 0, "dispatch: empty list");
+		using R = typename Details::DispatchResult<F, Ts...>::Type;
+		return Details::DispatchTable<R, F, Ts...>::entries[index](std::forward<F>(f));
+	}
+
+	template<typename... Ts, typename F>
+	constexpr decltype(auto) dispatch(List<Ts...>, size_t index, F&& f, SwitchDispatchTag)
+	{
+		static_assert(sizeof...(Ts) > 0, "dispatch: empty list");
+		using R = typename Details::DispatchResult<F, Ts...>::Type;
+		using Root = Details::SwitchDispatch<R, 0, Details::switch_dispatch_span(sizeof...(Ts)), List<Ts...>>;
+		return Root::invoke(index, std::forward<F>(f));
+	}
+
+	/** Runtime dispatch **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
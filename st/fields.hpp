@@ -0,0 +1,517 @@
+#pragma once
+// Fields: member descriptors, binary serialization, word-wise equality and hashing
+#include "list.hpp"
+
+#include <cstring>
+
+namespace ST
+{
+	/*************************************************************************************************************/
+	/* Field descriptors and serialization */
+	// Fields<Members...> lists members of one class in wire order; each member is an IntegralConstant holding a pointer
+	// to member object, written ST_FIELD(&C::a), or fields<&C::a, &C::b> with C++17. The wire format is the members
+	// packed in order, each in the chosen byte order. Members are integral, floating point or enum values of 1, 2, 4
+	// or 8 bytes, or arrays of them. Members copied as they are and adjacent in the class are merged into one memcpy.
+
+	_ST_INLINE_VAR constexpr struct LittleEndianTag {} little_endian = {};
+	_ST_INLINE_VAR constexpr struct BigEndianTag {} big_endian = {};
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	using NativeEndianTag = BigEndianTag;
+#else
+	using NativeEndianTag = LittleEndianTag;
+#endif
+
+#define ST_FIELD(MEMBER) ::ST::IntegralConstant<decltype(MEMBER), MEMBER>
+
+	template<typename F, typename Order = LittleEndianTag>
+	class FieldsView;
+
+	template<typename... Members>
+	struct Fields
+	{
+		static_assert(sizeof...(Members) > 0, "fields: no members");
+
+		// Bytes taken on the wire, as an integral constant
+		static constexpr auto wire_size();
+
+		// Writes wire_size() bytes to out and returns the end of them
+		template<typename C, typename Order = LittleEndianTag>
+		static unsigned char* encode(const C& object, unsigned char* out, Order = {});
+
+		// Reads wire_size() bytes from in into the members and returns the end of them
+		template<typename C, typename Order = LittleEndianTag>
+		static const unsigned char* decode(C& object, const unsigned char* in, Order = {});
+
+		// Reads members straight from a received buffer, without decoding the others
+		template<typename Order = LittleEndianTag>
+		static FieldsView<Fields, Order> view(const unsigned char* in, Order = {}) { return FieldsView<Fields, Order>(in); }
+
+		// BoolConstantTrue when the members are integral or enum values that tile the whole class without padding.
+		// equal and hash then read the object as 8-byte words, without branches; otherwise they go member by member.
+		static constexpr auto compares_blocks();
+
+		template<typename C>
+		static bool equal(const C& a, const C& b);
+
+		// Equal objects have equal hashes; for floating point members, 0.0 and -0.0 hash the same
+		template<typename C>
+		static std::uint64_t hash(const C& object);
+
+		// Function objects for hashed containers
+		struct Equal
+		{
+			template<typename C>
+			bool operator()(const C& a, const C& b) const { return equal(a, b); }
+		};
+
+		struct Hash
+		{
+			template<typename C>
+			size_t operator()(const C& object) const { return static_cast<size_t>(hash(object)); }
+		};
+	};
+
+#if defined(__cpp_nontype_template_parameter_auto)
+	template<auto... Members>
+	constexpr Fields<IntegralConstant<decltype(Members), Members>...> fields = {};
+#endif
+
+	template<typename... Members, typename Order>
+	class FieldsView<Fields<Members...>, Order>
+	{
+	public:
+		explicit FieldsView(const unsigned char* data) : data_(data) {}
+
+		// The value of the Nth member; an array member gives a FieldArrayView
+		template<typename T, T N>
+		auto operator[](IntegralConstant<T, N>) const;
+
+		const unsigned char* data() const { return data_; }
+
+	private:
+		const unsigned char* data_;
+	};
+
+	// Elements of an array member, read from the buffer one at a time
+	template<typename T, typename Order>
+	class FieldArrayView
+	{
+	public:
+		FieldArrayView(const unsigned char* data, size_t size) : data_(data), size_(size) {}
+
+		T operator[](size_t index) const;
+		size_t size() const { return size_; }
+		const unsigned char* data() const { return data_; }
+
+	private:
+		const unsigned char* data_;
+		size_t size_;
+	};
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Field serialization **/
+
+		template<typename Member>
+		struct MemberOf;
+
+		template<typename T, typename C, T C::* Pointer>
+		struct MemberOf<IntegralConstant<T C::*, Pointer>>
+		{
+			static_assert(!std::is_function<T>::value, "fields: members must be pointers to member objects");
+
+			using Class = C;
+			using Type = T;
+			using Element = std::remove_all_extents_t<T>;
+
+			static_assert(is_scalar_category(TypeCategory<Element>{}) && !std::is_pointer<Element>::value && !std::is_member_pointer<Element>::value
+				&& (sizeof(Element) == 1 || sizeof(Element) == 2 || sizeof(Element) == 4 || sizeof(Element) == 8),
+				"fields: members must be integral, floating point or enum values of 1, 2, 4 or 8 bytes, or arrays of them");
+
+			static constexpr size_t count = sizeof(T) / sizeof(Element);
+
+			static const unsigned char* address(const C& object) { return reinterpret_cast<const unsigned char*>(&(object.*Pointer)); }
+			static unsigned char* address(C& object) { return reinterpret_cast<unsigned char*>(&(object.*Pointer)); }
+			static const Element* elements(const C& object) { return reinterpret_cast<const Element*>(&(object.*Pointer)); }
+		};
+
+		template<size_t Size> struct WireWord;
+		template<> struct WireWord<1> { using Type = std::uint8_t; };
+		template<> struct WireWord<2> { using Type = std::uint16_t; };
+		template<> struct WireWord<4> { using Type = std::uint32_t; };
+		template<> struct WireWord<8> { using Type = std::uint64_t; };
+
+		inline std::uint8_t byte_swap(std::uint8_t x) { return x; }
+#if defined(__GNUC__) || defined(__clang__)
+		inline std::uint16_t byte_swap(std::uint16_t x) { return __builtin_bswap16(x); }
+		inline std::uint32_t byte_swap(std::uint32_t x) { return __builtin_bswap32(x); }
+		inline std::uint64_t byte_swap(std::uint64_t x) { return __builtin_bswap64(x); }
+#else
+		inline std::uint16_t byte_swap(std::uint16_t x) { return static_cast<std::uint16_t>(x << 8 | x >> 8); }
+		inline std::uint32_t byte_swap(std::uint32_t x) { return std::uint32_t{ byte_swap(static_cast<std::uint16_t>(x)) } << 16 | byte_swap(static_cast<std::uint16_t>(x >> 16)); }
+		inline std::uint64_t byte_swap(std::uint64_t x) { return std::uint64_t{ byte_swap(static_cast<std::uint32_t>(x)) } << 32 | byte_swap(static_cast<std::uint32_t>(x >> 32)); }
+#endif
+
+		// Copies count elements from in to out, reversing the bytes of each
+		template<typename Element>
+		void copy_swapped(unsigned char* out, const unsigned char* in, size_t count)
+		{
+			using Word = typename WireWord<sizeof(Element)>::Type;
+			for (size_t i = 0; i < count; ++i)
+			{
+				Word word;
+				std::memcpy(&word, in + i * sizeof(Word), sizeof(Word));
+				word = byte_swap(word);
+				std::memcpy(out + i * sizeof(Word), &word, sizeof(Word));
+			}
+		}
+
+		// Elements of one byte, and every element in native order, are copied as they are
+		template<typename Element, typename Order>
+		constexpr bool is_verbatim() { return sizeof(Element) == 1 || std::is_same<Order, NativeEndianTag>::value; }
+
+		template<typename Element, typename Order>
+		Element load_element(const unsigned char* in)
+		{
+			Element value;
+			if (is_verbatim<Element, Order>())
+				std::memcpy(&value, in, sizeof(Element));
+			else
+				copy_swapped<Element>(reinterpret_cast<unsigned char*>(&value), in, 1);
+			return value;
+		}
+
+		template<typename Order, typename... Members>
+		struct FieldCodec
+		{
+			template<size_t I>
+			using Field = MemberOf<NthTypeOf<I, Members...>>;
+
+			using Class = typename Field<0>::Class;
+
+			static constexpr size_t length = sizeof...(Members);
+
+			static constexpr bool verbatim(size_t i)
+			{
+				const bool flags[] = { is_verbatim<typename MemberOf<Members>::Element, Order>()... };
+				return flags[i];
+			}
+
+			static constexpr size_t wire_offset(size_t i)
+			{
+				const size_t sizes[] = { sizeof(typename MemberOf<Members>::Type)... };
+				size_t offset = 0;
+				for (size_t j = 0; j < i; ++j)
+					offset += sizes[j];
+				return offset;
+			}
+
+			// [run_begin(i), run_end(i)) is the longest stretch of verbatim members around i
+			static constexpr size_t run_begin(size_t i)
+			{
+				while (i > 0 && verbatim(i) && verbatim(i - 1))
+					--i;
+				return i;
+			}
+
+			static constexpr size_t run_end(size_t i)
+			{
+				while (i + 1 < length && verbatim(i) && verbatim(i + 1))
+					++i;
+				return i + 1;
+			}
+
+			// Whether members Begin, Begin + 1, ... follow each other in the class without padding. Member addresses are
+			// constant offsets, so this folds to a constant.
+			template<size_t Begin, typename Object, size_t... Is>
+			static bool adjacent(Object& object, std::index_sequence<Is...>)
+			{
+				bool result = true;
+				const int expand[] = { 0, (result = result && Field<Begin + Is + 1>::address(object) ==
+					Field<Begin + Is>::address(object) + sizeof(typename Field<Begin + Is>::Type), 0)... };
+				(void)expand;
+				return result;
+			}
+
+			template<size_t I>
+			static void encode_field(const Class& object, unsigned char* out)
+			{
+				constexpr size_t begin = run_begin(I);
+				constexpr size_t end = run_end(I);
+				if (!verbatim(I))
+					copy_swapped<typename Field<I>::Element>(out + wire_offset(I), Field<I>::address(object), Field<I>::count);
+				else if (!adjacent<begin>(object, std::make_index_sequence<end - begin - 1>{}))
+					std::memcpy(out + wire_offset(I), Field<I>::address(object), sizeof(typename Field<I>::Type));
+				else if (I == begin)
+					std::memcpy(out + wire_offset(begin), Field<begin>::address(object), wire_offset(end) - wire_offset(begin));
+			}
+
+			template<size_t I>
+			static void decode_field(Class& object, const unsigned char* in)
+			{
+				constexpr size_t begin = run_begin(I);
+				constexpr size_t end = run_end(I);
+				if (!verbatim(I))
+					copy_swapped<typename Field<I>::Element>(Field<I>::address(object), in + wire_offset(I), Field<I>::count);
+				else if (!adjacent<begin>(object, std::make_index_sequence<end - begin - 1>{}))
+					std::memcpy(Field<I>::address(object), in + wire_offset(I), sizeof(typename Field<I>::Type));
+				else if (I == begin)
+					std::memcpy(Field<begin>::address(object), in + wire_offset(begin), wire_offset(end) - wire_offset(begin));
+			}
+
+			template<size_t... Is>
+			static void encode(const Class& object, unsigned char* out, std::index_sequence<Is...>)
+			{
+				const int expand[] = { 0, (encode_field<Is>(object, out), 0)... };
+				(void)expand;
+			}
+
+			template<size_t... Is>
+			static void decode(Class& object, const unsigned char* in, std::index_sequence<Is...>)
+			{
+				const int expand[] = { 0, (decode_field<Is>(object, in), 0)... };
+				(void)expand;
+			}
+
+			template<size_t I>
+			static auto read(const unsigned char* data, BoolConstantFalse /*array*/)
+			{
+				return load_element<typename Field<I>::Type, Order>(data + wire_offset(I));
+			}
+
+			template<size_t I>
+			static auto read(const unsigned char* data, BoolConstantTrue /*array*/)
+			{
+				return FieldArrayView<typename Field<I>::Element, Order>(data + wire_offset(I), Field<I>::count);
+			}
+		};
+
+		template<typename... Members>
+		struct FieldKey
+		{
+			using Class = typename MemberOf<NthTypeOf<0, Members...>>::Class;
+
+			static_assert(all_same<Class, typename MemberOf<Members>::Class...>,
+				"fields: members must belong to the same class");
+
+			template<typename Member>
+			static constexpr size_t occurrences()
+			{
+				const bool same[] = { std::is_same<Member, Members>::value... };
+				size_t count = 0;
+				for (bool flag : same)
+					count += flag;
+				return count;
+			}
+
+			static constexpr size_t member_bytes()
+			{
+				const size_t sizes[] = { sizeof(typename MemberOf<Members>::Type)... };
+				size_t bytes = 0;
+				for (size_t size : sizes)
+					bytes += size;
+				return bytes;
+			}
+
+			// Distinct members whose sizes add up to the class cover every byte of it. Floating point members are left
+			// out, as 0.0 == -0.0 and NaN != NaN do not follow their bytes.
+			static constexpr bool blocks =
+				all_of<!std::is_floating_point<typename MemberOf<Members>::Element>::value...> &&
+				member_bytes() == sizeof(Class) &&
+				all_of<(occurrences<Members>() == 1)...>;
+
+			static std::uint64_t load_word(const unsigned char* bytes)
+			{
+				std::uint64_t word;
+				std::memcpy(&word, bytes, sizeof(word));
+				return word;
+			}
+
+			// Bytes [offset, offset + 8) of the object, or the remaining ones zero extended in a class below 8 bytes
+			static std::uint64_t word_at(const unsigned char* bytes, size_t offset)
+			{
+				if (sizeof(Class) >= sizeof(std::uint64_t))
+					return load_word(bytes + offset);
+				std::uint64_t word = 0;
+				std::memcpy(&word, bytes, sizeof(Class));
+				return word;
+			}
+
+			static constexpr size_t words = (sizeof(Class) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+			// Word I of the object; the last one overlaps the one before when the size is not a multiple of 8
+			static constexpr size_t word_offset(size_t i)
+			{
+				return sizeof(Class) < sizeof(std::uint64_t) ? 0 :
+					i + 1 < words ? i * sizeof(std::uint64_t) : sizeof(Class) - sizeof(std::uint64_t);
+			}
+
+			// Unrolled into straight-line code, which compilers may also pair into 16 or 32 byte vector operations
+			template<typename F, size_t... Is>
+			static void for_each_word(const unsigned char* a, const unsigned char* b, F&& f, std::index_sequence<Is...>)
+			{
+				const int expand[] = { 0, (f(word_at(a, word_offset(Is)), word_at(b, word_offset(Is))), 0)... };
+				(void)expand;
+			}
+
+			template<typename F>
+			static void for_each_word(const unsigned char* a, const unsigned char* b, F&& f)
+			{
+				for_each_word(a, b, f, std::make_index_sequence<words>{});
+			}
+
+			static std::uint64_t combine(std::uint64_t hash, std::uint64_t word)
+			{
+				return ((hash << 29 | hash >> 35) ^ word) * 0x9E3779B97F4A7C15ull;
+			}
+
+			static bool equal(const Class& a, const Class& b, BoolConstantTrue /*blocks*/)
+			{
+				std::uint64_t difference = 0;
+				for_each_word(reinterpret_cast<const unsigned char*>(&a), reinterpret_cast<const unsigned char*>(&b),
+					[&](std::uint64_t x, std::uint64_t y) { difference |= x ^ y; });
+				return difference == 0;
+			}
+
+			static std::uint64_t hash(const Class& object, BoolConstantTrue /*blocks*/)
+			{
+				const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&object);
+				std::uint64_t hash = sizeof(Class);
+				for_each_word(bytes, bytes, [&](std::uint64_t word, std::uint64_t) { hash = combine(hash, word); });
+				return mix_hash(hash);
+			}
+
+			template<typename Member>
+			static bool equal_member(const Class& a, const Class& b)
+			{
+				bool result = true;
+				for (size_t i = 0; i < Member::count; ++i)
+					result &= Member::elements(a)[i] == Member::elements(b)[i];
+				return result;
+			}
+
+			template<typename Element>
+			static std::uint64_t element_word(Element value, FloatingPointTag)
+			{
+				if (value == 0)
+					value = 0;
+				return element_word(value, IntegralTag{});
+			}
+
+			template<typename Element, typename Category>
+			static std::uint64_t element_word(Element value, Category)
+			{
+				typename WireWord<sizeof(Element)>::Type word;
+				std::memcpy(&word, &value, sizeof(Element));
+				return word;
+			}
+
+			template<typename Member>
+			static std::uint64_t hash_member(std::uint64_t hash, const Class& object)
+			{
+				using Element = typename Member::Element;
+				for (size_t i = 0; i < Member::count; ++i)
+					hash = combine(hash, element_word(Member::elements(object)[i], TypeCategory<Element>{}));
+				return hash;
+			}
+
+			// Every member is compared; the results are combined without branching
+			static bool equal(const Class& a, const Class& b, BoolConstantFalse /*blocks*/)
+			{
+				bool result = true;
+				const int expand[] = { 0, (result &= equal_member<MemberOf<Members>>(a, b), 0)... };
+				(void)expand;
+				return result;
+			}
+
+			static std::uint64_t hash(const Class& object, BoolConstantFalse /*blocks*/)
+			{
+				std::uint64_t hash = member_bytes();
+				const int expand[] = { 0, (hash = hash_member<MemberOf<Members>>(hash, object), 0)... };
+				(void)expand;
+				return mix_hash(hash);
+			}
+		};
+
+		/** Field serialization **/
+
+	} // namespace Details
+
+	/** Field serialization **/
+
+	template<typename... Members>
+	constexpr auto Fields<Members...>::wire_size()
+	{
+		return IntegralConstant<size_t, Details::FieldCodec<LittleEndianTag, Members...>::wire_offset(sizeof...(Members))>{};
+	}
+
+	template<typename... Members>
+	template<typename C, typename Order>
+	unsigned char* Fields<Members...>::encode(const C& object, unsigned char* out, Order)
+	{
+		using Codec = Details::FieldCodec<Order, Members...>;
+		static_assert(std::is_same<C, typename Codec::Class>::value, "fields: object is not of the class of the members");
+		Codec::encode(object, out, std::index_sequence_for<Members...>{});
+		return out + static_cast<size_t>(wire_size());
+	}
+
+	template<typename... Members>
+	template<typename C, typename Order>
+	const unsigned char* Fields<Members...>::decode(C& object, const unsigned char* in, Order)
+	{
+		using Codec = Details::FieldCodec<Order, Members...>;
+		static_assert(std::is_same<C, typename Codec::Class>::value, "fields: object is not of the class of the members");
+		Codec::decode(object, in, std::index_sequence_for<Members...>{});
+		return in + static_cast<size_t>(wire_size());
+	}
+
+	template<typename... Members>
+	constexpr auto Fields<Members...>::compares_blocks()
+	{
+		return BoolConstant<Details::FieldKey<Members...>::blocks>{};
+	}
+
+	template<typename... Members>
+	template<typename C>
+	bool Fields<Members...>::equal(const C& a, const C& b)
+	{
+		using Key = Details::FieldKey<Members...>;
+		static_assert(std::is_same<C, typename Key::Class>::value, "fields: object is not of the class of the members");
+		return Key::equal(a, b, compares_blocks());
+	}
+
+	template<typename... Members>
+	template<typename C>
+	std::uint64_t Fields<Members...>::hash(const C& object)
+	{
+		using Key = Details::FieldKey<Members...>;
+		static_assert(std::is_same<C, typename Key::Class>::value, "fields: object is not of the class of the members");
+		return Key::hash(object, compares_blocks());
+	}
+
+	template<typename... Members, typename Order>
+	template<typename T, T N>
+	auto FieldsView<Fields<Members...>, Order>::operator[](IntegralConstant<T, N>) const
+	{
+		using Codec = Details::FieldCodec<Order, Members...>;
+		using Type = typename Codec::template Field<static_cast<size_t>(N)>::Type;
+		return Codec::template read<static_cast<size_t>(N)>(data_, BoolConstant<std::is_array<Type>::value>{});
+	}
+
+	template<typename T, typename Order>
+	T FieldArrayView<T, Order>::operator[](size_t index) const
+	{
+		return Details::load_element<T, Order>(data_ + index * sizeof(T));
+	}
+
+	/** Field serialization **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
@@ -0,0 +1,474 @@
+#pragma once
+// inplace_function and inplace_any: type erasure without allocation
+#include "list.hpp"
+
+#include <new>
+#include <exception>
+#include <cstring>
+
+namespace ST
+{
+	/*************************************************************************************************************/
+	/* Type erasure without allocation */
+	// inplace_function and inplace_any keep their payload in a buffer of Capacity bytes; a payload that does not
+	// fit, or needs a stricter alignment than std::max_align_t, is a compilation error. Copy, move and destroy
+	// are chosen per payload: trivially copyable payloads are copied with memcpy and never destroyed.
+	// Payloads must be copy constructible and nothrow move constructible.
+
+	_ST_INLINE_VAR constexpr size_t default_inplace_capacity = 4 * sizeof(void*);
+
+	namespace Details
+	{
+		struct InplaceOps;
+
+		// Whether an lvalue of F can be called as Signature
+		template<typename F, typename Signature>
+		struct InplaceCallable;
+
+		template<size_t Capacity>
+		struct InplaceStorage
+		{
+			static_assert(Capacity > 0, "inplace storage: zero capacity");
+			alignas(std::max_align_t) unsigned char bytes[Capacity];
+		};
+	}
+
+	template<typename Signature, size_t Capacity = default_inplace_capacity>
+	class inplace_function;
+
+	// Functions, function pointers, pointers to members and function objects called as R(Args...). A null pointer
+	// to function or to member makes an empty inplace_function.
+	template<typename R, typename... Args, size_t Capacity>
+	class inplace_function<R(Args...), Capacity>
+	{
+	public:
+		inplace_function() = default;
+		inplace_function(std::nullptr_t) {}
+
+		template<typename F, typename = std::enable_if_t<!std::is_same<std::decay_t<F>, inplace_function>::value &&
+			Details::InplaceCallable<std::decay_t<F>, R(Args...)>::value>>
+		inplace_function(F&& f);
+
+		inplace_function(const inplace_function& other);
+		inplace_function(inplace_function&& other) noexcept;
+		inplace_function& operator=(const inplace_function& other);
+		inplace_function& operator=(inplace_function&& other) noexcept;
+		inplace_function& operator=(std::nullptr_t) noexcept;
+		~inplace_function();
+
+		// Calling an empty inplace_function terminates
+		R operator()(Args... args) const { return invoke_(storage_.bytes, std::forward<Args>(args)...); }
+
+		explicit operator bool() const { return invoke_ != &empty_invoke; }
+
+		void swap(inplace_function& other) noexcept;
+
+	private:
+		using Invoker = R(*)(void*, Args&&...);
+
+		[[noreturn]] static R empty_invoke(void*, Args&&...) { std::terminate(); }
+
+		void reset() noexcept;
+
+		Invoker invoke_ = &empty_invoke;
+		const Details::InplaceOps* ops_ = nullptr; // null for trivially copyable payloads
+		mutable Details::InplaceStorage<Capacity> storage_;
+	};
+
+	template<size_t Capacity = default_inplace_capacity>
+	class inplace_any
+	{
+	public:
+		inplace_any() = default;
+
+		template<typename T, typename = std::enable_if_t<!std::is_same<std::decay_t<T>, inplace_any>::value &&
+			std::is_copy_constructible<std::decay_t<T>>::value>>
+		inplace_any(T&& value);
+
+		inplace_any(const inplace_any& other);
+		inplace_any(inplace_any&& other) noexcept;
+		inplace_any& operator=(const inplace_any& other);
+		inplace_any& operator=(inplace_any&& other) noexcept;
+		~inplace_any();
+
+		// Replaces the value with a T constructed from args
+		template<typename T, typename... ArgsT>
+		T& emplace(Tag<T>, ArgsT&&... args);
+		void reset() noexcept;
+
+		bool has_value() const { return type_ != nullptr; }
+
+		template<typename T>
+		bool holds(Tag<T>) const;
+
+		// The value if it is a T, otherwise nullptr
+		template<typename T>
+		T* get_if(Tag<T>);
+		template<typename T>
+		const T* get_if(Tag<T>) const;
+
+		void swap(inplace_any& other) noexcept;
+
+	private:
+		const char* type_ = nullptr; // identity of the payload type, null when empty
+		const Details::InplaceOps* ops_ = nullptr; // null for trivially copyable payloads
+		Details::InplaceStorage<Capacity> storage_;
+	};
+
+	template<typename Signature, size_t Capacity>
+	void swap(inplace_function<Signature, Capacity>& a, inplace_function<Signature, Capacity>& b) noexcept { a.swap(b); }
+
+	template<size_t Capacity>
+	void swap(inplace_any<Capacity>& a, inplace_any<Capacity>& b) noexcept { a.swap(b); }
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Type erasure without allocation **/
+
+		struct InplaceOps
+		{
+			void (*copy)(void* to, const void* from);
+			// Moves to uninitialized storage and destroys the source
+			void (*relocate)(void* to, void* from);
+			void (*destroy)(void* storage);
+		};
+
+		template<typename T>
+		struct InplaceOpsOf
+		{
+			static void copy(void* to, const void* from) { ::new (to) T(*static_cast<const T*>(from)); }
+
+			static void relocate(void* to, void* from)
+			{
+				::new (to) T(std::move(*static_cast<T*>(from)));
+				static_cast<T*>(from)->~T();
+			}
+
+			static void destroy(void* storage) { static_cast<T*>(storage)->~T(); }
+
+			static constexpr InplaceOps ops = { &copy, &relocate, &destroy };
+		};
+
+		template<typename T>
+		constexpr InplaceOps InplaceOpsOf<T>::ops;
+
+		template<typename T>
+		constexpr const InplaceOps* inplace_ops_of(std::true_type /*trivially copyable*/) { return nullptr; }
+
+		template<typename T>
+		constexpr const InplaceOps* inplace_ops_of(std::false_type) { return &InplaceOpsOf<T>::ops; }
+
+		template<typename T, size_t Capacity>
+		void check_inplace_payload()
+		{
+			static_assert(Tag<T>::size() <= IntegralConstant<size_t, Capacity>{}, "inplace: payload larger than the capacity");
+			static_assert(Tag<T>::alignment() <= IntegralConstant<size_t, alignof(std::max_align_t)>{}, "inplace: payload over-aligned");
+			static_assert(std::is_copy_constructible<T>::value, "inplace: payload must be copy constructible");
+			static_assert(std::is_nothrow_move_constructible<T>::value, "inplace: payload must be nothrow move constructible");
+		}
+
+		// Copies, moves or destroys the payload of a buffer whose ops are null by moving all of its bytes
+		template<size_t Capacity>
+		void inplace_copy(const InplaceOps* ops, InplaceStorage<Capacity>& to, const InplaceStorage<Capacity>& from)
+		{
+			if (ops)
+				ops->copy(to.bytes, from.bytes);
+			else
+				std::memcpy(to.bytes, from.bytes, Capacity);
+		}
+
+		template<size_t Capacity>
+		void inplace_relocate(const InplaceOps* ops, InplaceStorage<Capacity>& to, InplaceStorage<Capacity>& from)
+		{
+			if (ops)
+				ops->relocate(to.bytes, from.bytes);
+			else
+				std::memcpy(to.bytes, from.bytes, Capacity);
+		}
+
+		inline void inplace_destroy(const InplaceOps* ops, void* storage)
+		{
+			if (ops)
+				ops->destroy(storage);
+		}
+
+		// The object a pointer to a member of C is applied to: the argument itself, or what it points to
+		template<typename C, typename X>
+		X&& member_target(X&& x, std::true_type /*X is, or derives from, C*/) { return std::forward<X>(x); }
+
+		template<typename C, typename X>
+		auto member_target(X&& x, std::false_type) -> decltype(*std::forward<X>(x)) { return *std::forward<X>(x); }
+
+		// Invocation by the category of the callable
+		template<typename Category, typename F, typename... Args>
+		auto invoke_callable(TypeCategoryTagBase<Category>, F& f, Args&&... args)
+			-> decltype(f(std::forward<Args>(args)...))
+		{
+			return f(std::forward<Args>(args)...);
+		}
+
+		template<typename M, typename C, typename X, typename... Args>
+		auto invoke_callable(PointerToMemberFunctionTag, M C::* f, X&& x, Args&&... args)
+			-> decltype((member_target<C>(std::forward<X>(x), std::is_base_of<C, std::decay_t<X>>{}).*f)(std::forward<Args>(args)...))
+		{
+			return (member_target<C>(std::forward<X>(x), std::is_base_of<C, std::decay_t<X>>{}).*f)(std::forward<Args>(args)...);
+		}
+
+		template<typename M, typename C, typename X>
+		auto invoke_callable(PointerToMemberObjectTag, M C::* f, X&& x)
+			-> decltype(member_target<C>(std::forward<X>(x), std::is_base_of<C, std::decay_t<X>>{}).*f)
+		{
+			return member_target<C>(std::forward<X>(x), std::is_base_of<C, std::decay_t<X>>{}).*f;
+		}
+
+		// Tests the call itself, which is why member_target and invoke_callable spell out their return types
+		template<typename R, typename F, typename... Args>
+		auto inplace_callable(int) -> std::integral_constant<bool, std::is_void<R>::value || std::is_convertible<
+			decltype(invoke_callable(type_category<F>(), std::declval<F&>(), std::declval<Args>()...)), R>::value>;
+
+		template<typename R, typename F, typename... Args>
+		std::false_type inplace_callable(...);
+
+		template<typename F, typename R, typename... Args>
+		struct InplaceCallable<F, R(Args...)> : decltype(inplace_callable<R, F, Args...>(0)) {};
+
+		// A null pointer to function or to member leaves the inplace_function empty, as it does std::function
+		template<typename F, typename Category>
+		bool is_null_callable(TypeCategoryTagBase<Category>, const F&) { return false; }
+
+		template<typename F>
+		bool is_null_callable(PointerTag, const F& f) { return f == nullptr; }
+
+		template<typename F>
+		bool is_null_callable(PointerToMemberFunctionTag, const F& f) { return f == nullptr; }
+
+		template<typename F>
+		bool is_null_callable(PointerToMemberObjectTag, const F& f) { return f == nullptr; }
+
+		template<typename R, typename F, typename... Args>
+		R invoke_returning(std::true_type /*void result*/, F& f, Args&&... args)
+		{
+			invoke_callable(type_category<F>(), f, std::forward<Args>(args)...);
+		}
+
+		template<typename R, typename F, typename... Args>
+		R invoke_returning(std::false_type, F& f, Args&&... args)
+		{
+			return invoke_callable(type_category<F>(), f, std::forward<Args>(args)...);
+		}
+
+		template<typename T, typename R, typename... Args>
+		R inplace_invoke(void* storage, Args&&... args)
+		{
+			return invoke_returning<R>(std::is_void<R>{}, *static_cast<T*>(storage), std::forward<Args>(args)...);
+		}
+
+		/** Type erasure without allocation **/
+
+	} // namespace Details
+
+	/** Type erasure without allocation **/
+
+	template<typename R, typename... Args, size_t Capacity>
+	template<typename F, typename>
+	inplace_function<R(Args...), Capacity>::inplace_function(F&& f)
+	{
+		using T = std::decay_t<F>;
+		Details::check_inplace_payload<T, Capacity>();
+		if (Details::is_null_callable<T>(type_category<T>(), f))
+			return;
+		::new (static_cast<void*>(storage_.bytes)) T(std::forward<F>(f));
+		invoke_ = &Details::inplace_invoke<T, R, Args...>;
+		ops_ = Details::inplace_ops_of<T>(std::is_trivially_copyable<T>{});
+	}
+
+	template<typename R, typename... Args, size_t Capacity>
+	inplace_function<R(Args...), Capacity>::inplace_function(const inplace_function& other)
+		: invoke_(other.invoke_), ops_(other.ops_)
+	{
+		Details::inplace_copy(ops_, storage_, other.storage_);
+	}
+
+	template<typename R, typename... Args, size_t Capacity>
+	inplace_function<R(Args...), Capacity>::inplace_function(inplace_function&& other) noexcept
+		: invoke_(other.invoke_), ops_(other.ops_)
+	{
+		Details::inplace_relocate(ops_, storage_, other.storage_);
+		other.invoke_ = &empty_invoke;
+		other.ops_ = nullptr;
+	}
+
+	template<typename R, typename... Args, size_t Capacity>
+	inplace_function<R(Args...), Capacity>& inplace_function<R(Args...), Capacity>::operator=(const inplace_function& other)
+	{
+		if (this != &other)
+			inplace_function(other).swap(*this);
+		return *this;
+	}
+
+	template<typename R, typename... Args, size_t Capacity>
+	inplace_function<R(Args...), Capacity>& inplace_function<R(Args...), Capacity>::operator=(inplace_function&& other) noexcept
+	{
+		if (this != &other)
+		{
+			reset();
+			Details::inplace_relocate(other.ops_, storage_, other.storage_);
+			invoke_ = other.invoke_;
+			ops_ = other.ops_;
+			other.invoke_ = &empty_invoke;
+			other.ops_ = nullptr;
+		}
+		return *this;
+	}
+
+	template<typename R, typename... Args, size_t Capacity>
+	inplace_function<R(Args...), Capacity>& inplace_function<R(Args...), Capacity>::operator=(std::nullptr_t) noexcept
+	{
+		reset();
+		return *this;
+	}
+
+	template<typename R, typename... Args, size_t Capacity>
+	inplace_function<R(Args...), Capacity>::~inplace_function()
+	{
+		Details::inplace_destroy(ops_, storage_.bytes);
+	}
+
+	template<typename R, typename... Args, size_t Capacity>
+	void inplace_function<R(Args...), Capacity>::swap(inplace_function& other) noexcept
+	{
+		if (this == &other)
+			return;
+		Details::InplaceStorage<Capacity> temporary;
+		Details::inplace_relocate(ops_, temporary, storage_);
+		Details::inplace_relocate(other.ops_, storage_, other.storage_);
+		Details::inplace_relocate(ops_, other.storage_, temporary);
+		std::swap(invoke_, other.invoke_);
+		std::swap(ops_, other.ops_);
+	}
+
+	template<typename R, typename... Args, size_t Capacity>
+	void inplace_function<R(Args...), Capacity>::reset() noexcept
+	{
+		Details::inplace_destroy(ops_, storage_.bytes);
+		invoke_ = &empty_invoke;
+		ops_ = nullptr;
+	}
+
+	template<size_t Capacity>
+	template<typename T, typename>
+	inplace_any<Capacity>::inplace_any(T&& value)
+	{
+		emplace(tag<std::decay_t<T>>, std::forward<T>(value));
+	}
+
+	template<size_t Capacity>
+	inplace_any<Capacity>::inplace_any(const inplace_any& other)
+		: type_(other.type_), ops_(other.ops_)
+	{
+		Details::inplace_copy(ops_, storage_, other.storage_);
+	}
+
+	template<size_t Capacity>
+	inplace_any<Capacity>::inplace_any(inplace_any&& other) noexcept
+		: type_(other.type_), ops_(other.ops_)
+	{
+		Details::inplace_relocate(ops_, storage_, other.storage_);
+		other.type_ = nullptr;
+		other.ops_ = nullptr;
+	}
+
+	template<size_t Capacity>
+	inplace_any<Capacity>& inplace_any<Capacity>::operator=(const inplace_any& other)
+	{
+		if (this != &other)
+			inplace_any(other).swap(*this);
+		return *this;
+	}
+
+	template<size_t Capacity>
+	inplace_any<Capacity>& inplace_any<Capacity>::operator=(inplace_any&& other) noexcept
+	{
+		if (this != &other)
+		{
+			reset();
+			Details::inplace_relocate(other.ops_, storage_, other.storage_);
+			type_ = other.type_;
+			ops_ = other.ops_;
+			other.type_ = nullptr;
+			other.ops_ = nullptr;
+		}
+		return *this;
+	}
+
+	template<size_t Capacity>
+	inplace_any<Capacity>::~inplace_any()
+	{
+		Details::inplace_destroy(ops_, storage_.bytes);
+	}
+
+	template<size_t Capacity>
+	template<typename T, typename... ArgsT>
+	T& inplace_any<Capacity>::emplace(Tag<T>, ArgsT&&... args)
+	{
+		static_assert(std::is_same<std::decay_t<T>, T>::value, "inplace_any: payload must be a cv-unqualified, non-array object type");
+		Details::check_inplace_payload<T, Capacity>();
+		reset();
+		T* value = ::new (static_cast<void*>(storage_.bytes)) T(std::forward<ArgsT>(args)...);
+		type_ = &Details::TypeId<T>::id;
+		ops_ = Details::inplace_ops_of<T>(std::is_trivially_copyable<T>{});
+		return *value;
+	}
+
+	template<size_t Capacity>
+	void inplace_any<Capacity>::reset() noexcept
+	{
+		Details::inplace_destroy(ops_, storage_.bytes);
+		type_ = nullptr;
+		ops_ = nullptr;
+	}
+
+	template<size_t Capacity>
+	template<typename T>
+	bool inplace_any<Capacity>::holds(Tag<T>) const
+	{
+		return type_ == &Details::TypeId<T>::id;
+	}
+
+	template<size_t Capacity>
+	template<typename T>
+	T* inplace_any<Capacity>::get_if(Tag<T> t)
+	{
+		return holds(t) ? static_cast<T*>(static_cast<void*>(storage_.bytes)) : nullptr;
+	}
+
+	template<size_t Capacity>
+	template<typename T>
+	const T* inplace_any<Capacity>::get_if(Tag<T> t) const
+	{
+		return holds(t) ? static_cast<const T*>(static_cast<const void*>(storage_.bytes)) : nullptr;
+	}
+
+	template<size_t Capacity>
+	void inplace_any<Capacity>::swap(inplace_any& other) noexcept
+	{
+		if (this == &other)
+			return;
+		Details::InplaceStorage<Capacity> temporary;
+		Details::inplace_relocate(ops_, temporary, storage_);
+		Details::inplace_relocate(other.ops_, storage_, other.storage_);
+		Details::inplace_relocate(ops_, other.storage_, temporary);
+		std::swap(type_, other.type_);
+		std::swap(ops_, other.ops_);
+	}
+
+	/** Type erasure without allocation **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
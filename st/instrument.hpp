@@ -0,0 +1,85 @@
+#pragma once
+// Opt-in instantiation records, enabled by defining ST_INSTRUMENT
+#include <cstddef>
+#include <cstdint>
+
+// With ST_INSTRUMENT defined, every instantiation of an instrumented template leaves one record in the binary: the name of
+// the operation and, for list operations, the length of the list. benchmark/instantiation_report.py reads them back.
+// Without it, _ST_INSTRUMENT expands to an empty static_assert and costs nothing.
+#if defined(ST_INSTRUMENT)
+
+// Records are never referenced, so they are kept explicitly; MSVC has no equivalent and needs /OPT:NOREF
+#	if defined(__has_attribute)
+#		if __has_attribute(retain)
+#			define _ST_INSTRUMENT_KEEP __attribute__((used, retain))
+#		endif
+#	endif
+#	if !defined(_ST_INSTRUMENT_KEEP)
+#		if defined(__GNUC__)
+#			define _ST_INSTRUMENT_KEEP __attribute__((used))
+#		else
+#			define _ST_INSTRUMENT_KEEP
+#		endif
+#	endif
+
+namespace ST
+{
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Instrumentation **/
+
+		// The layout read by benchmark/instantiation_report.py: magic bytes, a NUL-terminated name, a little-endian length
+		struct InstrumentationRecord
+		{
+			char magic[8];
+			char name[48];
+			std::uint64_t length;
+		};
+
+		constexpr InstrumentationRecord make_instrumentation_record(const char* name, std::uint64_t length)
+		{
+			InstrumentationRecord record{ { 'S', 'T', 'I', 'N', 'S', 'T', 'R', '\1' }, {}, length };
+			for (size_t i = 0; i < sizeof(record.name) - 1 && name[i] != '\0'; ++i)
+				record.name[i] = name[i];
+			return record;
+		}
+
+		// Site is a class local to the instrumented instantiation: one record per instantiation, which the linker
+		// merges when several translation units instantiate the same template
+		template<typename Site, size_t Length>
+		struct InstrumentationRegistration
+		{
+			_ST_INSTRUMENT_KEEP static const InstrumentationRecord record;
+		};
+
+		template<typename Site, size_t Length>
+		const InstrumentationRecord InstrumentationRegistration<Site, Length>::record =
+			make_instrumentation_record(Site::name(), Length);
+
+		// Taking the address instantiates the record, even when the instrumented template is only used at compile time
+		template<typename Site, size_t Length>
+		constexpr bool register_instantiation()
+		{
+			return &InstrumentationRegistration<Site, Length>::record != nullptr;
+		}
+
+		/** Instrumentation **/
+
+	} // namespace Details
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
+
+#	define _ST_INSTRUMENT(NAME, LENGTH)														\
+		struct StInstrumentationSite { static constexpr const char* name() { return NAME; } };	\
+		static_assert(::ST::Details::register_instantiation<StInstrumentationSite, (LENGTH)>(), "")
+#else
+// A declaration still, so that uses in class scope do not leave a stray ';'
+#	define _ST_INSTRUMENT(NAME, LENGTH) static_assert(true, "")
+#endif
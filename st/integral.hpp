@@ -0,0 +1,408 @@
+#pragma once
+// Integral constants, the _c and _uc literals and their operators
+#include "instrument.hpp"
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Constants at namespace scope are inline where the language has it, so that the module ST can export them
+#if defined(__cpp_inline_variables)
+#	define _ST_INLINE_VAR inline
+#else
+#	define _ST_INLINE_VAR
+#endif
+
+namespace ST
+{
+	/*************************************************************************************************************/
+	/* Forward Declarations */
+	template<typename T, T value> struct IntegralConstant;
+	struct None;
+	template<typename T> struct Tag;
+	template<typename... Ts> struct List;
+
+	/*************************************************************************************************************/
+	/* Integral constants */
+
+	template<typename T, T Value>
+	struct IntegralConstant
+	{
+		using underlying_type = T;
+
+		template<
+			typename ToType,
+			typename std::enable_if_t<std::is_convertible<T, ToType>::value, int> = 0>
+			constexpr explicit operator ToType() const { return static_cast<ToType>(Value); }
+
+		//for any IntegralConstant<non-bool>, explicit bool is defined. This is to prevent ambiguous conversion
+		template<typename Self = T, typename = std::enable_if_t<!std::is_same<std::remove_cv_t<Self>, bool>::value>>
+		constexpr explicit operator bool() const { return Value != 0; }
+
+		constexpr IntegralConstant() = default;
+
+		template<
+			typename OtherT,
+			OtherT OtherValue,
+			typename std::enable_if_t<std::is_convertible<OtherT, T>::value && (Value == OtherValue), int> = 0>
+			constexpr /*implicit*/ IntegralConstant(IntegralConstant<OtherT, OtherValue>) {}
+	};
+
+	template<bool Value>
+	using BoolConstant = IntegralConstant<bool, Value>;
+
+	using BoolConstantTrue = BoolConstant<true>;
+	using BoolConstantFalse = BoolConstant<false>;
+
+	_ST_INLINE_VAR constexpr BoolConstantTrue  true_c = {};
+	_ST_INLINE_VAR constexpr BoolConstantFalse false_c = {};
+
+#if defined(__cpp_nontype_template_parameter_auto)
+	// The constant V with its own type: Constant<42> is IntegralConstant<int, 42>
+	template<auto V>
+	using Constant = IntegralConstant<decltype(V), V>;
+
+	template<auto V>
+	constexpr Constant<V> constant = {};
+#endif
+
+	/*************************************************************************************************************/
+	/* Integral constant literals */
+	// Literals accept decimal, 0x hex, 0b binary and 0 octal digits with ' separators.
+	// Values above 64 bits use __int128 where the compiler has it; anything larger is a compilation error.
+
+	// Signed integral constant with automatic type that is enough to hold the value
+	template<char... Digits>
+	constexpr auto operator"" _c();
+
+	// Upper case _C is an alias to _c
+	template<char... Digits>
+	constexpr auto operator"" _C();
+
+	// Unsigned integral constant with automatic type that is enough to hold the value
+	template<char... Digits>
+	constexpr auto operator"" _uc();
+
+	// Upper case _UC is an alias to _uc
+	template<char... Digits>
+	constexpr auto operator"" _UC();
+
+	/*************************************************************************************************************/
+	/* Integral constant operators */
+
+	/* Comparison operators */
+
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr BoolConstant<value1 == value2>
+		operator== (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return{}; }
+
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr BoolConstant<value1 != value2>
+		operator!= (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return{}; }
+
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr BoolConstant <(value1 < value2)>
+		operator< (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return{}; }
+
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr BoolConstant<(value1 <= value2)>
+		operator<= (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return{}; }
+
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr BoolConstant<(value1 > value2)>
+		operator> (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return{}; }
+
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr BoolConstant<(value1 >= value2)>
+		operator>= (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return{}; }
+
+	// Arithmetic operators
+
+	// unary '+'
+	template<typename T, T value>
+	constexpr IntegralConstant<decltype(+value), +value>
+		operator+ (IntegralConstant<T, value>) { return {}; }
+
+	// unary '-'
+	template<typename T, T value>
+	constexpr IntegralConstant<decltype(-value), -value>
+		operator- (IntegralConstant<T, value>) { return {}; }
+
+	// binary '+'
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr IntegralConstant<decltype(value1 + value2), value1 + value2>
+		operator+ (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return {}; }
+
+	// binary '-'
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr IntegralConstant<decltype(value1 - value2), value1 - value2>
+		operator- (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return {}; }
+
+	// binary '*'
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr IntegralConstant<decltype(value1 * value2), value1 * value2>
+		operator* (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return {}; }
+
+	// '/'
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr IntegralConstant<decltype(value1 / value2), value1 / value2>
+		operator/ (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return {}; }
+
+	// '%'
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr IntegralConstant<decltype(value1 % value2), value1 % value2>
+		operator% (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return {}; }
+
+	// '~'
+	template<typename T, T value>
+	constexpr IntegralConstant<decltype(~value), ~value>
+		operator~ (IntegralConstant<T, value>) { return {}; }
+
+	// '^'
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr IntegralConstant<decltype(value1 ^ value2), value1 ^ value2>
+		operator^ (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return {}; }
+
+	// '&'
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr IntegralConstant<decltype(value1 & value2), value1 & value2>
+		operator& (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return {}; }
+
+	// '|'
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr IntegralConstant<decltype(value1 | value2), value1 | value2>
+		operator| (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return {}; }
+
+	// '<<'
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr IntegralConstant<decltype(value1 << value2), (value1 << value2)>
+		operator<< (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return {}; }
+
+	// '>>'
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr IntegralConstant<decltype(value1 >> value2), (value1 >> value2)>
+		operator>> (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return {}; }
+
+	// Logical operators
+	// '!'
+	template<typename T, T value>
+	constexpr IntegralConstant<decltype(!value), !value>
+		operator! (IntegralConstant<T, value>) { return {}; }
+
+	// '&&'
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr IntegralConstant<decltype(value1 && value2), value1 && value2>
+		operator&& (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return {}; }
+
+	// '||'
+	template<typename T1, typename T2, T1 value1, T2 value2>
+	constexpr IntegralConstant<decltype(value1 || value2), value1 || value2>
+		operator|| (IntegralConstant<T1, value1>, IntegralConstant<T2, value2>) { return {}; }
+
+	/*************************************************************************************************************/
+	/* Branching */
+	template<typename T1, typename T2>
+	constexpr auto select(BoolConstantTrue, T1 t1, T2) { return t1; }
+
+	template<typename T1, typename T2>
+	constexpr auto select(BoolConstantFalse, T1, T2 t2) { return t2; }
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Integral constant **/
+
+#if defined(__SIZEOF_INT128__)
+		__extension__ typedef __int128 WidestInt;
+		__extension__ typedef unsigned __int128 WidestUInt;
+#else
+		using WidestInt = long long;
+		using WidestUInt = unsigned long long;
+#endif
+
+		_ST_INLINE_VAR constexpr WidestUInt widest_int_max = static_cast<WidestUInt>(-1) >> 1;
+
+		template<typename T>
+		constexpr bool in_numeric_limits(WidestInt N)
+		{
+			return N >= std::numeric_limits<T>::min() && N <= std::numeric_limits<T>::max();
+		}
+
+		template<typename T>
+		constexpr bool in_unsigned_limits(WidestUInt N)
+		{
+			return N <= std::numeric_limits<T>::max();
+		}
+
+		// Position of the smallest 8, 16, 32, 64-bit or widest integral type holding N
+		constexpr int minimal_signed_rank(WidestInt N)
+		{
+			return
+				in_numeric_limits<std::int8_t>(N) ? 0 :
+				in_numeric_limits<std::int16_t>(N) ? 1 :
+				in_numeric_limits<std::int32_t>(N) ? 2 :
+				in_numeric_limits<std::int64_t>(N) ? 3 : 4;
+		}
+
+		constexpr int minimal_unsigned_rank(WidestUInt N)
+		{
+			return
+				in_unsigned_limits<std::uint8_t>(N) ? 0 :
+				in_unsigned_limits<std::uint16_t>(N) ? 1 :
+				in_unsigned_limits<std::uint32_t>(N) ? 2 :
+				in_unsigned_limits<std::uint64_t>(N) ? 3 : 4;
+		}
+
+		// The types depend on the rank only, so all values of the same width share their instantiations
+		template<int Rank>
+		using SignedOfRank =
+			std::conditional_t<Rank == 0, std::int8_t,
+			std::conditional_t<Rank == 1, std::int16_t,
+			std::conditional_t<Rank == 2, std::int32_t,
+			std::conditional_t<Rank == 3, std::int64_t, WidestInt>>>>;
+
+		template<int Rank>
+		using UnsignedOfRank =
+			std::conditional_t<Rank == 0, std::uint8_t,
+			std::conditional_t<Rank == 1, std::uint16_t,
+			std::conditional_t<Rank == 2, std::uint32_t,
+			std::conditional_t<Rank == 3, std::uint64_t, WidestUInt>>>>;
+
+		// Smallest signed integral type holding N
+		template<WidestInt N>
+		struct minimal_integral_type
+		{
+			using Type = SignedOfRank<minimal_signed_rank(N)>;
+		};
+
+		// Smallest unsigned integral type holding N
+		template<WidestUInt N>
+		struct minimal_unsigned_integral_type
+		{
+			using Type = UnsignedOfRank<minimal_unsigned_rank(N)>;
+		};
+
+		constexpr int literal_digit_value(char c)
+		{
+			return
+				c >= '0' && c <= '9' ? c - '0' :
+				c >= 'a' && c <= 'f' ? c - 'a' + 0xA :
+				c >= 'A' && c <= 'F' ? c - 'A' + 0xA :
+				-1;
+		}
+
+		struct LiteralValue
+		{
+			WidestUInt value;
+			bool invalid;
+			bool overflow;
+		};
+
+		// The characters of a literal, passed by value so that parsing is instantiated once per length, not per literal
+		template<size_t Length>
+		struct LiteralText
+		{
+			char chars[Length];
+		};
+
+		// A single loop over the characters of the literal, whatever its base
+		template<size_t Length>
+		constexpr LiteralValue parse_literal(LiteralText<Length> text)
+		{
+			const char* chars = text.chars;
+			const size_t length = Length;
+
+			unsigned base = 10;
+			size_t i = 0;
+			if (length > 2 && chars[0] == '0' && (chars[1] == 'x' || chars[1] == 'X'))
+				base = 16, i = 2;
+			else if (length > 2 && chars[0] == '0' && (chars[1] == 'b' || chars[1] == 'B'))
+				base = 2, i = 2;
+			else if (length > 1 && chars[0] == '0')
+				base = 8, i = 1;
+
+			LiteralValue result{};
+			for (; i < length; ++i)
+			{
+				if (chars[i] == '\'')
+					continue;
+				const int digit = literal_digit_value(chars[i]);
+				if (digit < 0 || static_cast<unsigned>(digit) >= base)
+				{
+					result.invalid = true;
+					return result;
+				}
+				if (result.value > (static_cast<WidestUInt>(-1) - static_cast<unsigned>(digit)) / base)
+				{
+					result.overflow = true;
+					return result;
+				}
+				result.value = result.value * base + static_cast<unsigned>(digit);
+			}
+			return result;
+		}
+
+		template<char... Digits>
+		constexpr auto parse()
+		{
+			_ST_INSTRUMENT("literal._c", sizeof...(Digits));
+			constexpr LiteralValue literal = parse_literal(LiteralText<sizeof...(Digits)>{ { Digits... } });
+			static_assert(!literal.invalid, "_c: not an integer literal, or a digit is out of range for its base");
+			static_assert(!literal.overflow && literal.value <= widest_int_max, "_c: value does not fit in the widest signed integral type");
+			using min_type = SignedOfRank<minimal_signed_rank(static_cast<WidestInt>(literal.value))>;
+			return IntegralConstant<min_type, static_cast<min_type>(literal.value)>{};
+		}
+
+		template<char... Digits>
+		constexpr auto parse_unsigned()
+		{
+			_ST_INSTRUMENT("literal._uc", sizeof...(Digits));
+			constexpr LiteralValue literal = parse_literal(LiteralText<sizeof...(Digits)>{ { Digits... } });
+			static_assert(!literal.invalid, "_uc: not an integer literal, or a digit is out of range for its base");
+			static_assert(!literal.overflow, "_uc: value does not fit in the widest unsigned integral type");
+			using min_type = UnsignedOfRank<minimal_unsigned_rank(literal.value)>;
+			return IntegralConstant<min_type, static_cast<min_type>(literal.value)>{};
+		}
+
+		/** Integral constant **/
+
+	} // namespace Details
+
+	/** Integral Constants **/
+
+	template<char... Digits>
+	constexpr auto operator"" _c()
+	{
+		return Details::parse<Digits...>();
+	}
+
+	// User-defined literal NUMBERLITERAL_C
+	template<char... Digits>
+	constexpr auto operator"" _C()
+	{
+		return operator""_c<Digits...>();
+	}
+
+	template<char... Digits>
+	constexpr auto operator"" _uc()
+	{
+		return Details::parse_unsigned<Digits...>();
+	}
+
+	// User-defined literal NUMBERLITERAL_UC
+	template<char... Digits>
+	constexpr auto operator"" _UC()
+	{
+		return operator""_uc<Digits...>();
+	}
+
+	/** Integral Constants **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
@@ -0,0 +1,828 @@
+#pragma once
+// List<Ts...>, the type list, and its algorithms
+#include "tag.hpp"
+
+#if defined(__has_builtin)
+#	if __has_builtin(__type_pack_element)
+#		define _ST_HAS_TYPE_PACK_ELEMENT 1
+#	endif
+#endif
+
+namespace ST
+{
+#define POSSIBLE_RETURN(...) auto
+
+	/*************************************************************************************************************/
+	/* Type list */
+	namespace Details
+	{
+		template<size_t N, typename... Ts>
+		struct TypeAtImpl;
+
+		// True when every flag is true, for any number of flags including none
+#if defined(__cpp_fold_expressions)
+		template<bool... Flags>
+		constexpr bool all_of = (Flags && ...);
+#else
+		// Shifting the pack by one position leaves it unchanged
+		template<bool... Flags>
+		constexpr bool all_of = std::is_same<List<BoolConstant<Flags>..., BoolConstantTrue>, List<BoolConstantTrue, BoolConstant<Flags>...>>::value;
+#endif
+
+		// True when every type is T
+#if defined(__cpp_fold_expressions)
+		template<typename T, typename... Ts>
+		constexpr bool all_same = (std::is_same_v<T, Ts> && ...);
+#else
+		template<typename T, typename... Ts>
+		constexpr bool all_same = std::is_same<List<Ts..., T>, List<T, Ts...>>::value;
+#endif
+	}
+
+	// The N-th type of Ts..., resolved in constant instantiation depth
+	template<size_t N, typename... Ts> using NthTypeOf =
+		typename Details::TypeAtImpl<N, Ts...>::Type;
+
+	template<typename... Ts>
+	struct List
+	{
+		static constexpr IntegralConstant<size_t, sizeof...(Ts)> length = {};
+
+		template<typename T, T N>
+		constexpr auto operator[] (IntegralConstant<T, N>) const
+		{
+			_ST_INSTRUMENT("list.at", sizeof...(Ts));
+			static_assert(N >= 0 && static_cast<size_t>(N) < sizeof...(Ts), "List index out of range");
+			return tag<NthTypeOf<static_cast<size_t>(N), Ts...>>;
+		}
+	};
+
+	template<typename... Ts>
+	constexpr IntegralConstant<size_t, sizeof...(Ts)> List<Ts...>::length;
+
+	template<typename ... Ts>
+	constexpr List<Ts...> list = {};
+
+	template<typename ... Ts, typename T>
+	constexpr auto operator+(Tag<T>, List<Ts...>)
+	{
+		_ST_INSTRUMENT("list.push_front", sizeof...(Ts));
+		return list<T, Ts...>;
+	}
+
+	template<typename... Types1, typename... Types2>
+	constexpr auto operator+(List<Types1...>, List<Types2...>)
+	{
+		_ST_INSTRUMENT("list.concat", sizeof...(Types1) + sizeof...(Types2));
+		return list<Types1..., Types2...>;
+	}
+
+	// Removes the first occurrence of T, if any
+	template<typename... Ts, typename T>
+	constexpr auto operator-(List<Ts...>, Tag<T>);
+
+	//helper functions
+
+	template<typename Head, typename... Tails>
+	constexpr auto list_first_or_default(List<Head, Tails...>)
+	{
+		return tag<Head>;
+	}
+
+	constexpr auto list_first_or_default(List<>) { return none; }
+
+	template<typename Head, typename... Tails>
+	constexpr auto list_without_first(List<Head, Tails...>)
+	{
+		return list<Tails...>;
+	}
+
+	constexpr auto list_without_first(List<> l) { return l; }
+
+	template<typename... Ts, typename T>
+	constexpr auto operator+(List<Ts...>, Tag<T>)
+	{
+		_ST_INSTRUMENT("list.push_back", sizeof...(Ts));
+		return list<Ts..., T>;
+	}
+
+	// Lists are compared as whole packs: partial ordering picks the first overload only when both packs are identical
+	template<typename... Ts>
+	constexpr BoolConstantTrue operator==(List<Ts...>, List<Ts...>) { return {}; }
+	template<typename... Types1, typename... Types2>
+	constexpr BoolConstantFalse operator==(List<Types1...>, List<Types2...>) { return {}; }
+	template<typename... Ts>
+	constexpr BoolConstantFalse operator!=(List<Ts...>, List<Ts...>) { return {}; }
+	template<typename... Types1, typename... Types2>
+	constexpr BoolConstantTrue operator!=(List<Types1...>, List<Types2...>) { return {}; }
+
+	/* Slicing: every algorithm below is a single index selection over the pack, in constant instantiation depth */
+
+	// Result of split_at
+	template<typename First, typename Second>
+	struct ListPair
+	{
+		static constexpr First first = {};
+		static constexpr Second second = {};
+	};
+
+	template<typename First, typename Second>
+	constexpr First ListPair<First, Second>::first;
+
+	template<typename First, typename Second>
+	constexpr Second ListPair<First, Second>::second;
+
+	// The types in reverse order
+	template<typename... Ts>
+	constexpr auto reverse(List<Ts...>);
+
+	// The first N types
+	template<typename... Ts, typename T, T N>
+	constexpr auto take(List<Ts...>, IntegralConstant<T, N>);
+
+	// All but the first N types
+	template<typename... Ts, typename T, T N>
+	constexpr auto drop(List<Ts...>, IntegralConstant<T, N>);
+
+	// ListPair of take(list, N) and drop(list, N)
+	template<typename... Ts, typename T, T N>
+	constexpr auto split_at(List<Ts...>, IntegralConstant<T, N>);
+
+	// Rotates left so that the N-th type comes first
+	template<typename... Ts, typename T, T N>
+	constexpr auto rotate(List<Ts...>, IntegralConstant<T, N>);
+
+	// The types in [Begin, End)
+	template<typename... Ts, typename T1, T1 Begin, typename T2, T2 End>
+	constexpr auto slice(List<Ts...>, IntegralConstant<T1, Begin>, IntegralConstant<T2, End>);
+
+	/* Set algebra: membership is a base class lookup, never a recursive instantiation */
+
+	template<typename... Ts, typename T>
+	constexpr POSSIBLE_RETURN(BoolConstantTrue, BoolConstantFalse) contains(List<Ts...>, Tag<T>);
+
+	// Position of the first occurrence of T
+	template<typename... Ts, typename T>
+	constexpr POSSIBLE_RETURN(None, IntegralConstant<size_t, ...>) index_of(List<Ts...>, Tag<T>);
+
+	// First occurrence of each type, in order
+	template<typename... Ts>
+	constexpr auto unique(List<Ts...>);
+
+	// unique(l1 + l2)
+	template<typename... Types1, typename... Types2>
+	constexpr auto set_union(List<Types1...>, List<Types2...>);
+
+	// Types of unique(l1) that are also in l2, in the order of l1
+	template<typename... Types1, typename... Types2>
+	constexpr auto set_intersection(List<Types1...>, List<Types2...>);
+
+	// Types of unique(l1) that are not in l2, in the order of l1
+	template<typename... Types1, typename... Types2>
+	constexpr auto set_difference(List<Types1...>, List<Types2...>);
+
+	/* Sorting: a stable merge sort of the positions by key, evaluated in one constant expression */
+
+	// Types ordered by key(tag<T>), which must be an IntegralConstant; equal keys keep their order
+	template<typename... Ts, typename Key>
+	constexpr auto sort(List<Ts...>, Key key);
+
+	// Built-in keys
+
+	_ST_INLINE_VAR constexpr struct SizeKey
+	{
+		template<typename T>
+		constexpr auto operator()(Tag<T>) const;
+	} size_key = {};
+
+	_ST_INLINE_VAR constexpr struct AlignmentKey
+	{
+		template<typename T>
+		constexpr auto operator()(Tag<T>) const;
+	} alignment_key = {};
+
+	// Tag<T>::hash(): the same in every translation unit and build with a given compiler
+	_ST_INLINE_VAR constexpr struct HashKey
+	{
+		template<typename T>
+		constexpr auto operator()(Tag<T>) const;
+	} hash_key = {};
+
+	/* Transformation and grouping: one selection over the pack per result list, whatever the number of matches */
+
+	// Result of group_by: the types whose key is Key, in their order in the list
+	template<typename Key, typename Types>
+	struct ListGroup
+	{
+		static constexpr Key key = {};
+		static constexpr Types types = {};
+	};
+
+	template<typename Key, typename Types>
+	constexpr Key ListGroup<Key, Types>::key;
+
+	template<typename Key, typename Types>
+	constexpr Types ListGroup<Key, Types>::types;
+
+	// The types of f(tag<T>), which must be a Tag, for every T
+	template<typename... Ts, typename F>
+	constexpr auto transform(List<Ts...>, F f);
+
+	// The types for which pred(tag<T>) is true_c; pred must give true_c or false_c
+	template<typename... Ts, typename Pred>
+	constexpr auto filter(List<Ts...>, Pred pred);
+
+	// ListPair of the types for which pred(tag<T>) is true_c and of the others
+	template<typename... Ts, typename Pred>
+	constexpr auto partition(List<Ts...>, Pred pred);
+
+	// A List of ListGroups, one for each distinct key(tag<T>) in order of first appearance
+	template<typename... Ts, typename Key>
+	constexpr auto group_by(List<Ts...>, Key key);
+
+	// Tag<T>::category(), to group by type category
+	_ST_INLINE_VAR constexpr struct CategoryKey
+	{
+		template<typename T>
+		constexpr auto operator()(Tag<T>) const;
+	} category_key = {};
+
+	/*************************************************************************************************************/
+	/* Type unpacking */
+
+	template<template<typename...> class PartialT, typename... Ts>
+	constexpr Tag<PartialT<Ts...>> combine(PartialTag<PartialT>, List<Ts...>) { return {}; }
+
+	template<template<typename...> class PartialT, typename... Ts>
+	constexpr Tag<PartialT<Ts...>> combine(PartialTag<PartialT>, Tag<Ts>...) { return {}; }
+
+#undef POSSIBLE_RETURN
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Type list indexing **/
+
+		template<typename T>
+		struct TypeIdentity
+		{
+			using Type = T;
+		};
+
+		// Every element becomes a distinct base of a single class, so that finding an element is a matter of
+		// overload resolution or base lookup against IndexedType<N, T> instead of N nested instantiations.
+		// The indexed base set is shared by all queries into the same pack.
+		template<size_t N, typename T>
+		struct IndexedType : TypeIdentity<T> {};
+
+		template<typename Indices, typename... Ts>
+		struct IndexedTypes;
+
+		template<size_t... Ns, typename... Ts>
+		struct IndexedTypes<std::index_sequence<Ns...>, Ts...> : IndexedType<Ns, Ts>... {};
+
+		template<typename... Ts>
+		using IndexedTypesOf = IndexedTypes<std::index_sequence_for<Ts...>, Ts...>;
+
+		// Position of T, which must occur exactly once
+		template<typename T, size_t N>
+		IntegralConstant<size_t, N> position_of(IndexedType<N, T>); //unevaluated only
+
+#if defined(_ST_HAS_TYPE_PACK_ELEMENT)
+		template<size_t N, typename... Ts>
+		struct TypeAtImpl
+		{
+			using Type = __type_pack_element<N, Ts...>;
+		};
+#else
+		template<size_t N, typename T>
+		TypeIdentity<T> type_at(IndexedType<N, T>); //unevaluated only
+
+		template<size_t N, typename... Ts>
+		struct TypeAtImpl
+		{
+			using Type = typename decltype(type_at<N>(IndexedTypesOf<Ts...>{}))::Type;
+		};
+#endif
+
+		/** Type list indexing **/
+
+		/** Type list slicing **/
+
+		template<typename L, typename Indices>
+		struct SelectImpl;
+
+		template<typename... Ts, size_t... Ns>
+		struct SelectImpl<List<Ts...>, std::index_sequence<Ns...>>
+		{
+#if defined(_ST_HAS_TYPE_PACK_ELEMENT)
+			using Type = List<__type_pack_element<Ns, Ts...>...>;
+#else
+			using Type = List<typename decltype(type_at<Ns>(IndexedTypesOf<Ts...>{}))::Type...>;
+#endif
+		};
+
+		template<size_t Begin, typename Indices>
+		struct OffsetIndices;
+
+		template<size_t Begin, size_t... Ns>
+		struct OffsetIndices<Begin, std::index_sequence<Ns...>>
+		{
+			using Type = std::index_sequence<(Begin + Ns)...>;
+		};
+
+		template<size_t Length, typename Indices>
+		struct ReverseIndices;
+
+		template<size_t Length, size_t... Ns>
+		struct ReverseIndices<Length, std::index_sequence<Ns...>>
+		{
+			using Type = std::index_sequence<(Length - 1 - Ns)...>;
+		};
+
+		template<size_t Length, size_t Shift, typename Indices>
+		struct RotateIndices;
+
+		template<size_t Length, size_t Shift, size_t... Ns>
+		struct RotateIndices<Length, Shift, std::index_sequence<Ns...>>
+		{
+			using Type = std::index_sequence<((Ns + Shift) % Length)...>;
+		};
+
+		template<typename L, size_t Begin, size_t End>
+		using SliceOf = typename SelectImpl<L, typename OffsetIndices<Begin, std::make_index_sequence<End - Begin>>::Type>::Type;
+
+		template<typename T, T N, size_t Length>
+		constexpr bool in_list_bounds = N >= 0 && static_cast<size_t>(N) <= Length;
+
+		/** Type list slicing **/
+
+		/** Type list filtering **/
+
+		// Membership is a base lookup: TypeIdentity<T> is a (possibly repeated) base of IndexedTypesOf<Ts...> iff T is in Ts
+		template<typename T, typename... Ts>
+		constexpr bool list_contains = std::is_base_of<TypeIdentity<T>, IndexedTypesOf<Ts...>>::value;
+
+		_ST_INLINE_VAR constexpr size_t npos = static_cast<size_t>(-1);
+
+		// One constant per type: distinct types have distinct addresses, which can be compared in constant expressions.
+		// Used to find repeated types; the ids are kept in local arrays, which are much cheaper to read than static members.
+		template<typename T>
+		struct TypeId
+		{
+			static constexpr char id = 0;
+		};
+
+		template<typename T>
+		constexpr char TypeId<T>::id;
+
+		using TypeIdPtr = const char*;
+
+		// Index of id in ids[0, count), or count
+		constexpr size_t find_id(const TypeIdPtr* ids, size_t count, TypeIdPtr id)
+		{
+			for (size_t i = 0; i < count; ++i)
+				if (ids[i] == id)
+					return i;
+			return count;
+		}
+
+		template<typename T, typename... Ts>
+		constexpr size_t index_of_impl()
+		{
+			const TypeIdPtr ids[] = { &TypeId<Ts>::id..., nullptr };
+			return list_contains<T, Ts...> ? find_id(ids, sizeof...(Ts), &TypeId<T>::id) : npos;
+		}
+
+		template<size_t N>
+		struct IndexBuffer
+		{
+			size_t values[N + 1];
+			size_t count;
+		};
+
+		// Indices of the first occurrence of every type
+		template<size_t N>
+		constexpr IndexBuffer<N> first_occurrences(const TypeIdPtr* ids)
+		{
+			IndexBuffer<N> result{};
+			for (size_t i = 0; i < N; ++i)
+				if (find_id(ids, i, ids[i]) == i)
+					result.values[result.count++] = i;
+			return result;
+		}
+
+		template<size_t N>
+		constexpr IndexBuffer<N> masked_indices(const bool* mask)
+		{
+			IndexBuffer<N> result{};
+			for (size_t i = 0; i < N; ++i)
+				if (mask[i])
+					result.values[result.count++] = i;
+			return result;
+		}
+
+		template<size_t N>
+		constexpr IndexBuffer<N> all_indices_but(size_t skipped)
+		{
+			IndexBuffer<N> result{};
+			for (size_t i = 0; i < N; ++i)
+				if (i != skipped)
+					result.values[result.count++] = i;
+			return result;
+		}
+
+		template<typename Filter>
+		struct KeptIndices
+		{
+			static constexpr decltype(Filter::indices()) value = Filter::indices();
+		};
+
+		template<typename Filter>
+		constexpr decltype(Filter::indices()) KeptIndices<Filter>::value;
+
+		// Keeps the types at Filter::indices(), in order
+		template<typename L, typename Filter, typename Indices = std::make_index_sequence<KeptIndices<Filter>::value.count>>
+		struct FilterImpl;
+
+		template<typename... Ts, typename Filter, size_t... Ns>
+		struct FilterImpl<List<Ts...>, Filter, std::index_sequence<Ns...>>
+		{
+			using Type = typename SelectImpl<List<Ts...>, std::index_sequence<KeptIndices<Filter>::value.values[Ns]...>>::Type;
+		};
+
+		// Keeps the types of L1 whose membership in L2 is InL2
+		template<typename L1, typename L2, typename InL2>
+		struct MembershipFilter;
+
+		template<typename... Types1, typename... Types2, bool InL2>
+		struct MembershipFilter<List<Types1...>, List<Types2...>, BoolConstant<InL2>>
+		{
+			static constexpr IndexBuffer<sizeof...(Types1)> indices()
+			{
+				const bool mask[] = { (list_contains<Types1, Types2...> == InL2)..., false };
+				return masked_indices<sizeof...(Types1)>(mask);
+			}
+		};
+
+		// Comparing ids pairwise is quadratic in constant evaluation steps, so only short lists are scanned
+		_ST_INLINE_VAR constexpr size_t unique_scan_length = 128;
+
+		template<typename L>
+		struct UniqueScanFilter;
+
+		template<typename... Ts>
+		struct UniqueScanFilter<List<Ts...>>
+		{
+			static constexpr IndexBuffer<sizeof...(Ts)> indices()
+			{
+				const TypeIdPtr ids[] = { &TypeId<Ts>::id..., nullptr };
+				return first_occurrences<sizeof...(Ts)>(ids);
+			}
+		};
+
+		template<typename L, typename = void>
+		struct UniqueImpl;
+
+		template<typename... Ts>
+		struct UniqueImpl<List<Ts...>, std::enable_if_t<(sizeof...(Ts) <= unique_scan_length)>>
+		{
+			using Type = typename FilterImpl<List<Ts...>, UniqueScanFilter<List<Ts...>>>::Type;
+		};
+
+		// Longer lists are halved: the unique back half only keeps what the unique front half lacks
+		template<typename... Ts>
+		struct UniqueImpl<List<Ts...>, std::enable_if_t<(sizeof...(Ts) > unique_scan_length)>>
+		{
+			using Front = typename UniqueImpl<SliceOf<List<Ts...>, 0, sizeof...(Ts) / 2>>::Type;
+			using Back = typename UniqueImpl<SliceOf<List<Ts...>, sizeof...(Ts) / 2, sizeof...(Ts)>>::Type;
+			using Type = decltype(Front{} + typename FilterImpl<Back, MembershipFilter<Back, Front, BoolConstantFalse>>::Type{});
+		};
+
+		template<typename L, typename T>
+		struct RemoveFirstFilter;
+
+		template<typename... Ts, typename T>
+		struct RemoveFirstFilter<List<Ts...>, T>
+		{
+			static constexpr IndexBuffer<sizeof...(Ts)> indices()
+			{
+				return all_indices_but<sizeof...(Ts)>(index_of_impl<T, Ts...>());
+			}
+		};
+
+#if !defined(__cpp_if_constexpr)
+		template<size_t Index>
+		struct IndexOfImpl
+		{
+			static constexpr auto index = IntegralConstant<size_t, Index>{};
+		};
+
+		template<>
+		struct IndexOfImpl<npos>
+		{
+			static constexpr auto index = none;
+		};
+#endif
+
+		/** Type list filtering **/
+
+		/** Type list sorting **/
+
+		// Bottom-up merge sort of the positions 0..N-1; a position from the right run goes first only on a strictly smaller key
+		template<size_t N, typename K>
+		constexpr IndexBuffer<N> sorted_indices(const K* keys)
+		{
+			IndexBuffer<N> sorted{};
+			IndexBuffer<N> merged{};
+			for (size_t i = 0; i < N; ++i)
+				sorted.values[i] = i;
+			sorted.count = merged.count = N;
+
+			for (size_t width = 1; width < N; width *= 2)
+			{
+				for (size_t low = 0; low < N; low += 2 * width)
+				{
+					const size_t middle = low + width < N ? low + width : N;
+					const size_t high = low + 2 * width < N ? low + 2 * width : N;
+					size_t left = low, right = middle, out = low;
+					while (left < middle && right < high)
+						merged.values[out++] = keys[sorted.values[right]] < keys[sorted.values[left]] ? sorted.values[right++] : sorted.values[left++];
+					while (left < middle)
+						merged.values[out++] = sorted.values[left++];
+					while (right < high)
+						merged.values[out++] = sorted.values[right++];
+				}
+				sorted = merged;
+			}
+			return sorted;
+		}
+
+		template<typename Key, typename T>
+		using KeyOf = decltype(std::declval<const Key&>()(tag<T>));
+
+		template<typename L, typename Key>
+		struct SortFilter;
+
+		template<typename... Ts, typename Key>
+		struct SortFilter<List<Ts...>, Key>
+		{
+			using Value = typename KeyOf<Key, NthTypeOf<0, Ts...>>::underlying_type;
+
+			static_assert(all_same<Value, typename KeyOf<Key, Ts>::underlying_type...>,
+				"sort: every key must be an IntegralConstant of the same type");
+
+			static constexpr IndexBuffer<sizeof...(Ts)> indices()
+			{
+				const Value keys[] = { static_cast<Value>(KeyOf<Key, Ts>{})..., Value() };
+				return sorted_indices<sizeof...(Ts)>(keys);
+			}
+		};
+
+		template<typename Key>
+		struct SortFilter<List<>, Key>
+		{
+			static constexpr IndexBuffer<0> indices() { return {}; }
+		};
+
+		/** Type list sorting **/
+
+		/** Type list grouping **/
+
+		// Any other result is a compilation error here
+		constexpr bool predicate_value(BoolConstantTrue) { return true; }
+		constexpr bool predicate_value(BoolConstantFalse) { return false; }
+
+		// Keeps the types for which Pred gives Keep
+		template<typename L, typename Pred, bool Keep>
+		struct PredicateFilter;
+
+		template<typename... Ts, typename Pred, bool Keep>
+		struct PredicateFilter<List<Ts...>, Pred, Keep>
+		{
+			static constexpr IndexBuffer<sizeof...(Ts)> indices()
+			{
+				const bool mask[] = { (predicate_value(KeyOf<Pred, Ts>{}) == Keep)..., false };
+				return masked_indices<sizeof...(Ts)>(mask);
+			}
+		};
+
+		template<size_t N>
+		constexpr IndexBuffer<N> matching_indices(const TypeIdPtr* ids, TypeIdPtr id)
+		{
+			IndexBuffer<N> result{};
+			for (size_t i = 0; i < N; ++i)
+				if (ids[i] == id)
+					result.values[result.count++] = i;
+			return result;
+		}
+
+		// Keeps the types whose key is K; keys are compared by TypeId, not by a trait per pair
+		template<typename L, typename Key, typename K>
+		struct GroupFilter;
+
+		template<typename... Ts, typename Key, typename K>
+		struct GroupFilter<List<Ts...>, Key, K>
+		{
+			static constexpr IndexBuffer<sizeof...(Ts)> indices()
+			{
+				const TypeIdPtr ids[] = { &TypeId<KeyOf<Key, Ts>>::id..., nullptr };
+				return matching_indices<sizeof...(Ts)>(ids, &TypeId<K>::id);
+			}
+		};
+
+		template<typename L, typename Key, typename Keys>
+		struct GroupByImpl;
+
+		template<typename... Ts, typename Key, typename... Ks>
+		struct GroupByImpl<List<Ts...>, Key, List<Ks...>>
+		{
+			using Type = List<ListGroup<Ks, typename FilterImpl<List<Ts...>, GroupFilter<List<Ts...>, Key, Ks>>::Type>...>;
+		};
+
+		/** Type list grouping **/
+
+	} // namespace Details
+
+	/** Type list **/
+
+	template<typename... Ts>
+	constexpr auto reverse(List<Ts...>)
+	{
+		_ST_INSTRUMENT("list.reverse", sizeof...(Ts));
+		using Indices = typename Details::ReverseIndices<sizeof...(Ts), std::index_sequence_for<Ts...>>::Type;
+		return typename Details::SelectImpl<List<Ts...>, Indices>::Type{};
+	}
+
+	template<typename... Ts, typename T, T N>
+	constexpr auto take(List<Ts...>, IntegralConstant<T, N>)
+	{
+		_ST_INSTRUMENT("list.take", sizeof...(Ts));
+		static_assert(Details::in_list_bounds<T, N, sizeof...(Ts)>, "take: count out of range");
+		return Details::SliceOf<List<Ts...>, 0, static_cast<size_t>(N)>{};
+	}
+
+	template<typename... Ts, typename T, T N>
+	constexpr auto drop(List<Ts...>, IntegralConstant<T, N>)
+	{
+		_ST_INSTRUMENT("list.drop", sizeof...(Ts));
+		static_assert(Details::in_list_bounds<T, N, sizeof...(Ts)>, "drop: count out of range");
+		return Details::SliceOf<List<Ts...>, static_cast<size_t>(N), sizeof...(Ts)>{};
+	}
+
+	template<typename... Ts, typename T, T N>
+	constexpr auto split_at(List<Ts...> l, IntegralConstant<T, N> n)
+	{
+		_ST_INSTRUMENT("list.split_at", sizeof...(Ts));
+		return ListPair<decltype(take(l, n)), decltype(drop(l, n))>{};
+	}
+
+	template<typename... Ts, typename T, T N>
+	constexpr auto rotate(List<Ts...>, IntegralConstant<T, N>)
+	{
+		_ST_INSTRUMENT("list.rotate", sizeof...(Ts));
+		static_assert(Details::in_list_bounds<T, N, sizeof...(Ts)>, "rotate: shift out of range");
+		using Indices = typename Details::RotateIndices<sizeof...(Ts), static_cast<size_t>(N), std::index_sequence_for<Ts...>>::Type;
+		return typename Details::SelectImpl<List<Ts...>, Indices>::Type{};
+	}
+
+	template<typename... Ts, typename T1, T1 Begin, typename T2, T2 End>
+	constexpr auto slice(List<Ts...>, IntegralConstant<T1, Begin>, IntegralConstant<T2, End>)
+	{
+		_ST_INSTRUMENT("list.slice", sizeof...(Ts));
+		static_assert(Details::in_list_bounds<T1, Begin, sizeof...(Ts)>, "slice: begin out of range");
+		static_assert(Details::in_list_bounds<T2, End, sizeof...(Ts)>, "slice: end out of range");
+		static_assert(static_cast<size_t>(Begin) <= static_cast<size_t>(End), "slice: begin after end");
+		return Details::SliceOf<List<Ts...>, static_cast<size_t>(Begin), static_cast<size_t>(End)>{};
+	}
+
+	template<typename... Ts, typename T>
+	constexpr auto operator-(List<Ts...>, Tag<T>)
+	{
+		_ST_INSTRUMENT("list.remove", sizeof...(Ts));
+		return typename Details::FilterImpl<List<Ts...>, Details::RemoveFirstFilter<List<Ts...>, T>>::Type{};
+	}
+
+	template<typename... Ts, typename T>
+	constexpr auto contains(List<Ts...>, Tag<T>)
+	{
+		_ST_INSTRUMENT("list.contains", sizeof...(Ts));
+		return BoolConstant<Details::list_contains<T, Ts...>>{};
+	}
+
+	template<typename... Ts, typename T>
+	constexpr auto index_of(List<Ts...>, Tag<T>)
+	{
+		_ST_INSTRUMENT("list.index_of", sizeof...(Ts));
+#if defined(__cpp_if_constexpr)
+		constexpr size_t index = Details::index_of_impl<T, Ts...>();
+		if constexpr (index == Details::npos)
+			return none;
+		else
+			return IntegralConstant<size_t, index>{};
+#else
+		return Details::IndexOfImpl<Details::index_of_impl<T, Ts...>()>::index;
+#endif
+	}
+
+	template<typename... Ts>
+	constexpr auto unique(List<Ts...>)
+	{
+		_ST_INSTRUMENT("list.unique", sizeof...(Ts));
+		return typename Details::UniqueImpl<List<Ts...>>::Type{};
+	}
+
+	template<typename... Types1, typename... Types2>
+	constexpr auto set_union(List<Types1...>, List<Types2...>)
+	{
+		_ST_INSTRUMENT("list.set_union", sizeof...(Types1) + sizeof...(Types2));
+		return unique(list<Types1..., Types2...>);
+	}
+
+	template<typename... Types1, typename... Types2>
+	constexpr auto set_intersection(List<Types1...>, List<Types2...>)
+	{
+		_ST_INSTRUMENT("list.set_intersection", sizeof...(Types1) + sizeof...(Types2));
+		using Unique1 = typename Details::UniqueImpl<List<Types1...>>::Type;
+		return typename Details::FilterImpl<Unique1, Details::MembershipFilter<Unique1, List<Types2...>, BoolConstantTrue>>::Type{};
+	}
+
+	template<typename... Types1, typename... Types2>
+	constexpr auto set_difference(List<Types1...>, List<Types2...>)
+	{
+		_ST_INSTRUMENT("list.set_difference", sizeof...(Types1) + sizeof...(Types2));
+		using Unique1 = typename Details::UniqueImpl<List<Types1...>>::Type;
+		return typename Details::FilterImpl<Unique1, Details::MembershipFilter<Unique1, List<Types2...>, BoolConstantFalse>>::Type{};
+	}
+
+	template<typename... Ts, typename Key>
+	constexpr auto sort(List<Ts...>, Key)
+	{
+		_ST_INSTRUMENT("list.sort", sizeof...(Ts));
+		return typename Details::FilterImpl<List<Ts...>, Details::SortFilter<List<Ts...>, Key>>::Type{};
+	}
+
+	template<typename... Ts, typename F>
+	constexpr auto transform(List<Ts...>, F)
+	{
+		_ST_INSTRUMENT("list.transform", sizeof...(Ts));
+		return List<typename Details::KeyOf<F, Ts>::Type...>{};
+	}
+
+	template<typename... Ts, typename Pred>
+	constexpr auto filter(List<Ts...>, Pred)
+	{
+		_ST_INSTRUMENT("list.filter", sizeof...(Ts));
+		return typename Details::FilterImpl<List<Ts...>, Details::PredicateFilter<List<Ts...>, Pred, true>>::Type{};
+	}
+
+	template<typename... Ts, typename Pred>
+	constexpr auto partition(List<Ts...>, Pred)
+	{
+		_ST_INSTRUMENT("list.partition", sizeof...(Ts));
+		return ListPair<
+			typename Details::FilterImpl<List<Ts...>, Details::PredicateFilter<List<Ts...>, Pred, true>>::Type,
+			typename Details::FilterImpl<List<Ts...>, Details::PredicateFilter<List<Ts...>, Pred, false>>::Type>{};
+	}
+
+	template<typename... Ts, typename Key>
+	constexpr auto group_by(List<Ts...>, Key)
+	{
+		_ST_INSTRUMENT("list.group_by", sizeof...(Ts));
+		using Keys = typename Details::UniqueImpl<List<Details::KeyOf<Key, Ts>...>>::Type;
+		return typename Details::GroupByImpl<List<Ts...>, Key, Keys>::Type{};
+	}
+
+	template<typename T>
+	constexpr auto SizeKey::operator()(Tag<T>) const
+	{
+		return Tag<T>::size();
+	}
+
+	template<typename T>
+	constexpr auto AlignmentKey::operator()(Tag<T>) const
+	{
+		return Tag<T>::alignment();
+	}
+
+	template<typename T>
+	constexpr auto HashKey::operator()(Tag<T>) const
+	{
+		return Tag<T>::hash();
+	}
+
+	template<typename T>
+	constexpr auto CategoryKey::operator()(Tag<T>) const
+	{
+		return Tag<T>::category();
+	}
+
+	/** Type list **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
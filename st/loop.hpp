@@ -0,0 +1,103 @@
+#pragma once
+// static_for and static_for_each
+#include "list.hpp"
+
+namespace ST
+{
+	/*************************************************************************************************************/
+	/* Compile-time loops */
+	// Unrolled in one pack expansion: f is called in order with each index of [Begin, End) as an IntegralConstant
+	// of the common type of the bounds, or with tag<T> for each type of the list. Returning false_c from f ends the
+	// loop after that iteration, any other iteration returns void or true_c. Every iteration is instantiated but
+	// only those up to the first false_c run. The result is false_c if an iteration returned false_c, even the last
+	// one, and true_c otherwise.
+
+	template<typename T, T Begin, typename U, U End, typename F>
+	constexpr auto static_for(IntegralConstant<T, Begin>, IntegralConstant<U, End>, F&& f);
+
+	template<typename... Ts, typename F>
+	constexpr auto static_for_each(List<Ts...>, F&& f);
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Compile-time loops **/
+
+		// Whether the loop goes on after an iteration returning R
+		template<typename R>
+		struct StaticLoopContinues
+		{
+			static_assert(std::is_void<R>::value, "static_for: f must return void or a BoolConstant");
+			static constexpr bool value = true;
+		};
+
+		template<bool Continue>
+		struct StaticLoopContinues<BoolConstant<Continue>>
+		{
+			static constexpr bool value = Continue;
+		};
+
+		// Number of iterations that run: up to and including the first one that stops
+		template<bool... Continues>
+		constexpr size_t static_loop_length()
+		{
+			constexpr bool continues[] = { true, Continues... };
+			for (size_t i = 1; i < sizeof(continues); ++i)
+				if (!continues[i])
+					return i;
+			return sizeof...(Continues);
+		}
+
+		template<typename F, typename Arg>
+		constexpr void static_loop_step(BoolConstantTrue /*runs*/, F& f, Arg arg) { f(arg); }
+
+		template<typename F, typename Arg>
+		constexpr void static_loop_step(BoolConstantFalse, F&, Arg) {}
+
+		template<typename F, size_t... Is, typename... Args>
+		constexpr auto static_loop(F& f, std::index_sequence<Is...>, Args... args)
+		{
+			constexpr size_t length = static_loop_length<
+				StaticLoopContinues<std::decay_t<decltype(f(args))>>::value...>();
+			using Expand = int[];
+			(void)Expand{ 0, (static_loop_step(BoolConstant<(Is < length)>{}, f, args), 0)... };
+			// Not length == sizeof...(Args): the loop also stops when the last iteration returns false_c
+			return BoolConstant<all_of<StaticLoopContinues<std::decay_t<decltype(f(args))>>::value...>>{};
+		}
+
+		template<typename T, T Begin, typename F, size_t... Is>
+		constexpr auto static_for_range(F& f, std::index_sequence<Is...> indices)
+		{
+			return static_loop(f, indices, IntegralConstant<T, static_cast<T>(Begin + static_cast<T>(Is))>{}...);
+		}
+
+		/** Compile-time loops **/
+
+	} // namespace Details
+
+	/** Compile-time loops **/
+
+	template<typename T, T Begin, typename U, U End, typename F>
+	constexpr auto static_for(IntegralConstant<T, Begin>, IntegralConstant<U, End>, F&& f)
+	{
+		using Index = std::common_type_t<T, U>;
+		static_assert(static_cast<Index>(Begin) <= static_cast<Index>(End), "static_for: the range ends before it begins");
+		return Details::static_for_range<Index, static_cast<Index>(Begin)>(f,
+			std::make_index_sequence<static_cast<size_t>(static_cast<Index>(End) - static_cast<Index>(Begin))>{});
+	}
+
+	template<typename... Ts, typename F>
+	constexpr auto static_for_each(List<Ts...>, F&& f)
+	{
+		return Details::static_loop(f, std::index_sequence_for<Ts...>{}, tag<Ts>...);
+	}
+
+	/** Compile-time loops **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
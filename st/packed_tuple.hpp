@@ -0,0 +1,271 @@
+#pragma once
+// packed_tuple: a tuple with its members ordered by alignment
+#include "list.hpp"
+
+namespace ST
+{
+	/*************************************************************************************************************/
+	/* Packed tuple */
+	// packed_tuple<Ts...> stores its elements sorted by Tag<T>::alignment(), strictest first, which leaves padding
+	// only at the end; reference elements are laid out as pointers. Elements keep their logical index: t[1_c] is the
+	// second type of Ts whatever its slot.
+
+	template<typename... Ts>
+	class packed_tuple;
+
+	namespace Details
+	{
+		template<typename... Ts>
+		struct PackedTupleStorage;
+
+		template<typename Self, typename... Us>
+		struct PackedConversion;
+	}
+
+	template<typename... Ts>
+	class packed_tuple : Details::PackedTupleStorage<Ts...>::Type
+	{
+		using Storage = typename Details::PackedTupleStorage<Ts...>::Type;
+
+	public:
+		static constexpr IntegralConstant<size_t, sizeof...(Ts)> length = {};
+
+		// Elements are value-initialized
+		constexpr packed_tuple() = default;
+
+		// One value per element, in logical order; only takes part in overload resolution when every element is
+		// constructible from its value, and is explicit unless every value converts implicitly
+		template<typename... Us, std::enable_if_t<Details::PackedConversion<packed_tuple, Us...>::implicit, int> = 0>
+		constexpr packed_tuple(Us&&... values);
+		template<typename... Us, std::enable_if_t<Details::PackedConversion<packed_tuple, Us...>::explicit_only, int> = 0>
+		constexpr explicit packed_tuple(Us&&... values);
+
+		template<typename T, T N>
+		constexpr NthTypeOf<static_cast<size_t>(N), Ts...>& operator[](IntegralConstant<T, N>) &;
+		template<typename T, T N>
+		constexpr const NthTypeOf<static_cast<size_t>(N), Ts...>& operator[](IntegralConstant<T, N>) const &;
+
+		// Tuple protocol, for structured bindings
+		template<size_t N>
+		constexpr NthTypeOf<N, Ts...>& get() &;
+		template<size_t N>
+		constexpr const NthTypeOf<N, Ts...>& get() const &;
+		template<size_t N>
+		constexpr NthTypeOf<N, Ts...>&& get() &&;
+
+		// Bytes of sizeof(packed_tuple) not taken by any element, as an IntegralConstant
+		static constexpr auto padding_bytes();
+	};
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Packed tuple **/
+
+		// Type whose size and alignment a member of type T takes: a reference member is stored as a pointer, whatever
+		// the size of the referenced type
+		template<typename T>
+		using PackedMember = std::conditional_t<std::is_reference<T>::value, std::add_pointer_t<T>, T>;
+
+		// Slot of the I-th element: elements with a stricter alignment come first, equal ones keep their order
+		constexpr size_t packed_slot(const size_t* alignments, size_t count, size_t i)
+		{
+			size_t slot = 0;
+			for (size_t j = 0; j < count; ++j)
+				if (alignments[j] > alignments[i] || (alignments[j] == alignments[i] && j < i))
+					++slot;
+			return slot;
+		}
+
+		// Logical indices in slot order, as a filter for FilterImpl
+		template<typename... Ts>
+		struct PackedOrder
+		{
+			static constexpr IndexBuffer<sizeof...(Ts)> indices()
+			{
+				const size_t alignments[] = { static_cast<size_t>(Tag<PackedMember<Ts>>::alignment())..., 0 };
+				IndexBuffer<sizeof...(Ts)> result{};
+				for (size_t i = 0; i < sizeof...(Ts); ++i)
+					result.values[packed_slot(alignments, sizeof...(Ts), i)] = i;
+				result.count = sizeof...(Ts);
+				return result;
+			}
+
+			static constexpr size_t slot(size_t i)
+			{
+				const size_t alignments[] = { static_cast<size_t>(Tag<PackedMember<Ts>>::alignment())..., 0 };
+				return packed_slot(alignments, sizeof...(Ts), i);
+			}
+
+			static constexpr size_t element_bytes()
+			{
+				const size_t sizes[] = { static_cast<size_t>(Tag<PackedMember<Ts>>::size())..., 0 };
+				size_t bytes = 0;
+				for (size_t size : sizes)
+					bytes += size;
+				return bytes;
+			}
+		};
+
+		template<size_t Slot, typename T>
+		struct PackedLeaf
+		{
+			constexpr PackedLeaf() : value() {}
+
+			template<typename U>
+			constexpr explicit PackedLeaf(U&& u) : value(std::forward<U>(u)) {}
+
+			T value;
+		};
+
+		// Forwarding references to constructor arguments, addressable by index
+		template<size_t I, typename T>
+		struct ArgumentLeaf
+		{
+			T&& value;
+		};
+
+		template<typename Indices, typename... Ts>
+		struct Arguments;
+
+		template<size_t... Is, typename... Ts>
+		struct Arguments<std::index_sequence<Is...>, Ts...> : ArgumentLeaf<Is, Ts>...
+		{
+			constexpr Arguments(Ts&&... values) : ArgumentLeaf<Is, Ts>{ std::forward<Ts>(values) }... {}
+		};
+
+		template<size_t I, typename T>
+		constexpr T&& argument_at(const ArgumentLeaf<I, T>& leaf) { return std::forward<T>(leaf.value); }
+
+		template<typename Order, typename Slots, typename Sorted>
+		struct PackedBases;
+
+		template<typename Order, size_t... Slots, typename... Sorted>
+		struct PackedBases<Order, std::index_sequence<Slots...>, List<Sorted...>> : PackedLeaf<Slots, Sorted>...
+		{
+			constexpr PackedBases() = default;
+
+			template<typename Args>
+			constexpr PackedBases(BoolConstantTrue, Args&& args)
+				: PackedLeaf<Slots, Sorted>(argument_at<KeptIndices<Order>::value.values[Slots]>(args))... {}
+		};
+
+		template<typename... Ts>
+		struct PackedTupleStorage
+		{
+			using Order = PackedOrder<Ts...>;
+			using Type = PackedBases<Order, std::index_sequence_for<Ts...>, typename FilterImpl<List<Ts...>, Order>::Type>;
+		};
+
+		// The traits are only instantiated once the count matches and the values are not a packed_tuple itself
+		template<bool Candidate, typename Elements, typename Values>
+		struct PackedConversionImpl
+		{
+			static constexpr bool implicit = false;
+			static constexpr bool explicit_only = false;
+		};
+
+		template<typename... Ts, typename... Us>
+		struct PackedConversionImpl<true, List<Ts...>, List<Us...>>
+		{
+			static constexpr bool constructible = all_of<std::is_constructible<Ts, Us&&>::value...>;
+			static constexpr bool convertible = all_of<std::is_convertible<Us&&, Ts>::value...>;
+			static constexpr bool implicit = constructible && convertible;
+			static constexpr bool explicit_only = constructible && !convertible;
+		};
+
+		template<typename... Ts, typename... Us>
+		struct PackedConversion<packed_tuple<Ts...>, Us...>
+			: PackedConversionImpl<sizeof...(Us) == sizeof...(Ts) && sizeof...(Us) != 0 &&
+				!std::is_same<List<std::decay_t<Us>...>, List<packed_tuple<Ts...>>>::value, List<Ts...>, List<Us...>>
+		{};
+
+		/** Packed tuple **/
+
+	} // namespace Details
+
+	/** Packed tuple **/
+
+	template<typename... Ts>
+	constexpr IntegralConstant<size_t, sizeof...(Ts)> packed_tuple<Ts...>::length;
+
+	template<typename... Ts>
+	template<typename... Us, std::enable_if_t<Details::PackedConversion<packed_tuple<Ts...>, Us...>::implicit, int>>
+	constexpr packed_tuple<Ts...>::packed_tuple(Us&&... values)
+		: Storage(true_c, Details::Arguments<std::index_sequence_for<Us...>, Us...>(std::forward<Us>(values)...))
+	{}
+
+	template<typename... Ts>
+	template<typename... Us, std::enable_if_t<Details::PackedConversion<packed_tuple<Ts...>, Us...>::explicit_only, int>>
+	constexpr packed_tuple<Ts...>::packed_tuple(Us&&... values)
+		: Storage(true_c, Details::Arguments<std::index_sequence_for<Us...>, Us...>(std::forward<Us>(values)...))
+	{}
+
+	template<typename... Ts>
+	template<typename T, T N>
+	constexpr NthTypeOf<static_cast<size_t>(N), Ts...>& packed_tuple<Ts...>::operator[](IntegralConstant<T, N>) &
+	{
+		static_assert(N >= 0 && static_cast<size_t>(N) < sizeof...(Ts), "packed_tuple index out of range");
+		return get<static_cast<size_t>(N)>();
+	}
+
+	template<typename... Ts>
+	template<typename T, T N>
+	constexpr const NthTypeOf<static_cast<size_t>(N), Ts...>& packed_tuple<Ts...>::operator[](IntegralConstant<T, N>) const &
+	{
+		static_assert(N >= 0 && static_cast<size_t>(N) < sizeof...(Ts), "packed_tuple index out of range");
+		return get<static_cast<size_t>(N)>();
+	}
+
+	template<typename... Ts>
+	template<size_t N>
+	constexpr NthTypeOf<N, Ts...>& packed_tuple<Ts...>::get() &
+	{
+		using Leaf = Details::PackedLeaf<Details::PackedOrder<Ts...>::slot(N), NthTypeOf<N, Ts...>>;
+		return static_cast<Leaf&>(*this).value;
+	}
+
+	template<typename... Ts>
+	template<size_t N>
+	constexpr const NthTypeOf<N, Ts...>& packed_tuple<Ts...>::get() const &
+	{
+		using Leaf = Details::PackedLeaf<Details::PackedOrder<Ts...>::slot(N), NthTypeOf<N, Ts...>>;
+		return static_cast<const Leaf&>(*this).value;
+	}
+
+	template<typename... Ts>
+	template<size_t N>
+	constexpr NthTypeOf<N, Ts...>&& packed_tuple<Ts...>::get() &&
+	{
+		// Not std::move: a reference element stays an lvalue reference, as with std::get
+		return static_cast<NthTypeOf<N, Ts...>&&>(get<N>());
+	}
+
+	template<typename... Ts>
+	constexpr auto packed_tuple<Ts...>::padding_bytes()
+	{
+		return IntegralConstant<size_t, sizeof(packed_tuple) - Details::PackedOrder<Ts...>::element_bytes()>{};
+	}
+
+	/** Packed tuple **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
+
+// Tuple protocol of ST::packed_tuple
+namespace std
+{
+	template<typename... Ts>
+	struct tuple_size<ST::packed_tuple<Ts...>> : integral_constant<size_t, sizeof...(Ts)> {};
+
+	template<size_t N, typename... Ts>
+	struct tuple_element<N, ST::packed_tuple<Ts...>>
+	{
+		using type = ST::NthTypeOf<N, Ts...>;
+	};
+}
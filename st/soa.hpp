@@ -0,0 +1,536 @@
+#pragma once
+// soa_vector: a struct of arrays
+#include "packed_tuple.hpp"
+
+#include <new>
+#include <iterator>
+#include <cstring>
+
+namespace ST
+{
+	/*************************************************************************************************************/
+	/* Struct of arrays */
+	// soa_vector<List<Ts...>> keeps one contiguous array per type of the list. All columns share one allocation
+	// and each starts on a cache line. Column sizes come from Tag<T>::size(). Growing moves the elements, so
+	// every type must be nothrow move constructible. Iterators are random access over row proxies that assign and
+	// swap element-wise, so mutating algorithms such as std::sort and std::reverse work; value_type is a
+	// packed_tuple copy of a row.
+
+	template<typename L>
+	class soa_vector;
+
+	namespace Details
+	{
+		template<typename T> class SoaColumn;
+		template<typename Vector> class SoaRowBase;
+		template<typename Vector> class SoaRow;
+		template<typename Vector> class SoaIterator;
+	}
+
+	template<typename... Ts>
+	class soa_vector<List<Ts...>>
+	{
+	public:
+		using size_type = size_t;
+		// A row copied out of the vector
+		using value_type = packed_tuple<Ts...>;
+		using reference = Details::SoaRow<soa_vector>;
+		using const_reference = Details::SoaRow<const soa_vector>;
+		using iterator = Details::SoaIterator<soa_vector>;
+		using const_iterator = Details::SoaIterator<const soa_vector>;
+
+		static constexpr IntegralConstant<size_t, sizeof...(Ts)> columns = {};
+
+		soa_vector() = default;
+		explicit soa_vector(size_t count);
+		soa_vector(const soa_vector& other);
+		soa_vector(soa_vector&& other) noexcept;
+		soa_vector& operator=(const soa_vector& other);
+		soa_vector& operator=(soa_vector&& other) noexcept;
+		~soa_vector();
+
+		size_t size() const { return size_; }
+		size_t capacity() const { return capacity_; }
+		bool empty() const { return size_ == 0; }
+
+		void reserve(size_t count);
+		// New rows are value-initialized
+		void resize(size_t count);
+		void clear();
+
+		// Appends a row made of one value per column
+		template<typename... Us>
+		void push_back(Us&&... values);
+		void pop_back();
+
+		// Contiguous view of the N-th column: data(), size(), operator[] and begin()/end() over plain pointers
+		template<typename T, T N>
+		Details::SoaColumn<NthTypeOf<static_cast<size_t>(N), Ts...>> column(IntegralConstant<T, N>);
+		template<typename T, T N>
+		Details::SoaColumn<const NthTypeOf<static_cast<size_t>(N), Ts...>> column(IntegralConstant<T, N>) const;
+
+		// Row proxy: v[i][N_c] is the element of the N-th column in row i
+		reference operator[](size_t row) { return { *this, row }; }
+		const_reference operator[](size_t row) const { return { *this, row }; }
+
+		iterator begin() { return { *this, 0 }; }
+		iterator end() { return { *this, size_ }; }
+		const_iterator begin() const { return { *this, 0 }; }
+		const_iterator end() const { return { *this, size_ }; }
+
+		void swap(soa_vector& other) noexcept;
+
+	private:
+		static_assert(sizeof...(Ts) > 0, "soa_vector: empty list of columns");
+		static_assert(Details::all_of<std::is_nothrow_move_constructible<Ts>::value...>,
+			"soa_vector: every column type must be nothrow move constructible");
+
+		using Columns = std::index_sequence_for<Ts...>;
+
+		// Cache line, or the strictest alignment among the columns if larger
+		static constexpr size_t alignment();
+		// Bytes needed for the given capacity; fills in the offset of every column
+		static size_t layout(size_t capacity, size_t (&offsets)[sizeof...(Ts)]);
+
+		template<size_t... Ns>
+		void reallocate(size_t capacity, std::index_sequence<Ns...>);
+		template<size_t... Ns, typename... Us>
+		void construct_row(std::index_sequence<Ns...>, Us&&... values);
+		template<size_t... Ns>
+		void copy_rows(const soa_vector& other, std::index_sequence<Ns...>, BoolConstantTrue);
+		template<size_t... Ns>
+		void copy_rows(const soa_vector& other, std::index_sequence<Ns...>, BoolConstantFalse);
+		// Values may refer to elements of this vector, so they are copied out before reallocating
+		void push_back_reallocating(Ts&&... values);
+		template<size_t... Ns>
+		void destroy_rows(size_t first, size_t last, std::index_sequence<Ns...>);
+
+		void grow_for(size_t count);
+
+		void* storage_ = nullptr;
+		void* data_[sizeof...(Ts)] = {};
+		size_t size_ = 0;
+		size_t capacity_ = 0;
+	};
+
+	template<typename... Ts>
+	void swap(soa_vector<List<Ts...>>& a, soa_vector<List<Ts...>>& b) noexcept { a.swap(b); }
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Struct of arrays **/
+
+		template<typename T>
+		class SoaColumn
+		{
+		public:
+			SoaColumn(T* data, size_t size) : data_(data), size_(size) {}
+
+			T* data() const { return data_; }
+			size_t size() const { return size_; }
+			T* begin() const { return data_; }
+			T* end() const { return data_ + size_; }
+			T& operator[](size_t index) const { return data_[index]; }
+
+		private:
+			T* data_;
+			size_t size_;
+		};
+
+		template<typename Vector>
+		class SoaRowBase
+		{
+		public:
+			using value_type = typename std::remove_const_t<Vector>::value_type;
+
+			SoaRowBase(Vector& vector, size_t row) : vector_(&vector), row_(row) {}
+
+			template<typename T, T N>
+			decltype(auto) operator[](IntegralConstant<T, N> n) const { return vector_->column(n)[row_]; }
+
+			size_t index() const { return row_; }
+
+			// Copies the row out. Never moves, since a row proxy that is an rvalue still refers to the vector.
+			operator value_type() const { return copy_out(Columns{}); }
+
+		protected:
+			using Columns = std::make_index_sequence<static_cast<size_t>(std::remove_const_t<Vector>::columns)>;
+
+			template<size_t... Ns>
+			value_type copy_out(std::index_sequence<Ns...>) const { return value_type((*this)[IntegralConstant<size_t, Ns>{}]...); }
+
+			Vector* vector_;
+			size_t row_;
+		};
+
+		// Row of a mutable vector. Assignment writes the elements, as it would through a reference; the row that is
+		// assigned is only copied, a value_type rvalue is moved. swap(a, b) exchanges the elements of two rows.
+		template<typename Vector>
+		class SoaRow : public SoaRowBase<Vector>
+		{
+			using Base = SoaRowBase<Vector>;
+			using typename Base::Columns;
+
+		public:
+			using typename Base::value_type;
+			using Base::Base;
+
+			SoaRow(const SoaRow&) = default;
+
+			SoaRow& operator=(const SoaRow& other) { copy_from(other, Columns{}); return *this; }
+			SoaRow& operator=(const SoaRow<const Vector>& other) { copy_from(other, Columns{}); return *this; }
+			SoaRow& operator=(const value_type& value) { copy_from(value, Columns{}); return *this; }
+			SoaRow& operator=(value_type&& value) { move_from(value, Columns{}); return *this; }
+
+			friend void swap(SoaRow a, SoaRow b) { a.swap_with(b, Columns{}); }
+
+		private:
+			template<typename Row, size_t... Ns>
+			void copy_from(const Row& other, std::index_sequence<Ns...>) const
+			{
+				using Expand = int[];
+				(void)Expand{ 0, ((*this)[IntegralConstant<size_t, Ns>{}] = other[IntegralConstant<size_t, Ns>{}], 0)... };
+			}
+
+			template<size_t... Ns>
+			void move_from(value_type& value, std::index_sequence<Ns...>) const
+			{
+				using Expand = int[];
+				(void)Expand{ 0, ((*this)[IntegralConstant<size_t, Ns>{}] = std::move(value[IntegralConstant<size_t, Ns>{}]), 0)... };
+			}
+
+			template<size_t... Ns>
+			void swap_with(const SoaRow& other, std::index_sequence<Ns...>) const
+			{
+				using std::swap;
+				using Expand = int[];
+				(void)Expand{ 0, (swap((*this)[IntegralConstant<size_t, Ns>{}], other[IntegralConstant<size_t, Ns>{}]), 0)... };
+			}
+		};
+
+		// Row of a const vector: read only
+		template<typename Vector>
+		class SoaRow<const Vector> : public SoaRowBase<const Vector>
+		{
+		public:
+			using SoaRowBase<const Vector>::SoaRowBase;
+
+			SoaRow(const SoaRow&) = default;
+			SoaRow& operator=(const SoaRow&) = delete;
+		};
+
+		template<typename Vector>
+		class SoaIterator
+		{
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = typename std::remove_const_t<Vector>::value_type;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+			using reference = SoaRow<Vector>;
+
+			SoaIterator() = default;
+			SoaIterator(Vector& vector, size_t row) : vector_(&vector), row_(row) {}
+
+			// iterator converts to const_iterator; mixed comparisons go through the operators of const_iterator
+			template<typename Other, typename = std::enable_if_t<std::is_const<Vector>::value &&
+				std::is_same<Other, std::remove_const_t<Vector>>::value>>
+			SoaIterator(const SoaIterator<Other>& other) : vector_(other.vector_), row_(other.row_) {}
+
+			reference operator*() const { return { *vector_, row_ }; }
+			reference operator[](difference_type n) const { return { *vector_, row_ + n }; }
+
+			SoaIterator& operator++() { ++row_; return *this; }
+			SoaIterator& operator--() { --row_; return *this; }
+			SoaIterator operator++(int) { SoaIterator old = *this; ++row_; return old; }
+			SoaIterator operator--(int) { SoaIterator old = *this; --row_; return old; }
+			SoaIterator& operator+=(difference_type n) { row_ += n; return *this; }
+			SoaIterator& operator-=(difference_type n) { row_ -= n; return *this; }
+
+			friend SoaIterator operator+(SoaIterator it, difference_type n) { return it += n; }
+			friend SoaIterator operator+(difference_type n, SoaIterator it) { return it += n; }
+			friend SoaIterator operator-(SoaIterator it, difference_type n) { return it -= n; }
+			friend difference_type operator-(SoaIterator a, SoaIterator b) { return difference_type(a.row_ - b.row_); }
+
+			friend bool operator==(SoaIterator a, SoaIterator b) { return a.row_ == b.row_; }
+			friend bool operator!=(SoaIterator a, SoaIterator b) { return a.row_ != b.row_; }
+			friend bool operator<(SoaIterator a, SoaIterator b) { return a.row_ < b.row_; }
+			friend bool operator>(SoaIterator a, SoaIterator b) { return a.row_ > b.row_; }
+			friend bool operator<=(SoaIterator a, SoaIterator b) { return a.row_ <= b.row_; }
+			friend bool operator>=(SoaIterator a, SoaIterator b) { return a.row_ >= b.row_; }
+
+		private:
+			template<typename> friend class SoaIterator;
+
+			Vector* vector_ = nullptr;
+			size_t row_ = 0;
+		};
+
+		// Moves count elements to uninitialized memory and destroys the originals
+		template<typename T>
+		void relocate_column(T* from, size_t count, T* to, std::true_type /*trivially copyable*/)
+		{
+			if (count)
+				std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(T));
+		}
+
+		template<typename T>
+		void relocate_column(T* from, size_t count, T* to, std::false_type)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				::new (static_cast<void*>(to + i)) T(std::move(from[i]));
+				from[i].~T();
+			}
+		}
+
+		template<typename T>
+		void destroy_column(T*, size_t, size_t, std::true_type /*trivially destructible*/) {}
+
+		template<typename T>
+		void destroy_column(T* column, size_t first, size_t last, std::false_type)
+		{
+			for (size_t i = first; i < last; ++i)
+				column[i].~T();
+		}
+
+		/** Struct of arrays **/
+
+	} // namespace Details
+
+	/** Struct of arrays **/
+
+	template<typename... Ts>
+	constexpr IntegralConstant<size_t, sizeof...(Ts)> soa_vector<List<Ts...>>::columns;
+
+	template<typename... Ts>
+	soa_vector<List<Ts...>>::soa_vector(size_t count)
+		: soa_vector()
+	{
+		resize(count);
+	}
+
+	template<typename... Ts>
+	soa_vector<List<Ts...>>::soa_vector(const soa_vector& other)
+		: soa_vector() // Delegating, so that the destructor frees the rows copied so far if a copy throws
+	{
+		reserve(other.size_);
+		copy_rows(other, Columns{}, BoolConstant<Details::all_of<std::is_trivially_copyable<Ts>::value...>>{});
+	}
+
+	template<typename... Ts>
+	soa_vector<List<Ts...>>::soa_vector(soa_vector&& other) noexcept
+	{
+		swap(other);
+	}
+
+	template<typename... Ts>
+	soa_vector<List<Ts...>>& soa_vector<List<Ts...>>::operator=(const soa_vector& other)
+	{
+		if (this != &other)
+			soa_vector(other).swap(*this);
+		return *this;
+	}
+
+	template<typename... Ts>
+	soa_vector<List<Ts...>>& soa_vector<List<Ts...>>::operator=(soa_vector&& other) noexcept
+	{
+		soa_vector(std::move(other)).swap(*this);
+		return *this;
+	}
+
+	template<typename... Ts>
+	soa_vector<List<Ts...>>::~soa_vector()
+	{
+		destroy_rows(0, size_, Columns{});
+		::operator delete(storage_);
+	}
+
+	template<typename... Ts>
+	void soa_vector<List<Ts...>>::reserve(size_t count)
+	{
+		if (count > capacity_)
+			reallocate(count, Columns{});
+	}
+
+	template<typename... Ts>
+	void soa_vector<List<Ts...>>::resize(size_t count)
+	{
+		if (count <= size_)
+		{
+			destroy_rows(count, size_, Columns{});
+			size_ = count;
+			return;
+		}
+		grow_for(count);
+		while (size_ < count)
+			construct_row(Columns{}, Ts()...);
+	}
+
+	template<typename... Ts>
+	void soa_vector<List<Ts...>>::clear()
+	{
+		destroy_rows(0, size_, Columns{});
+		size_ = 0;
+	}
+
+	template<typename... Ts>
+	template<typename... Us>
+	void soa_vector<List<Ts...>>::push_back(Us&&... values)
+	{
+		static_assert(sizeof...(Us) == sizeof...(Ts), "soa_vector::push_back: one value per column");
+		if (size_ == capacity_)
+			push_back_reallocating(Ts(std::forward<Us>(values))...);
+		else
+			construct_row(Columns{}, std::forward<Us>(values)...);
+	}
+
+	template<typename... Ts>
+	void soa_vector<List<Ts...>>::push_back_reallocating(Ts&&... values)
+	{
+		grow_for(size_ + 1);
+		construct_row(Columns{}, std::move(values)...);
+	}
+
+	template<typename... Ts>
+	void soa_vector<List<Ts...>>::pop_back()
+	{
+		destroy_rows(size_ - 1, size_, Columns{});
+		--size_;
+	}
+
+	template<typename... Ts>
+	template<typename T, T N>
+	Details::SoaColumn<NthTypeOf<static_cast<size_t>(N), Ts...>> soa_vector<List<Ts...>>::column(IntegralConstant<T, N>)
+	{
+		static_assert(N >= 0 && static_cast<size_t>(N) < sizeof...(Ts), "soa_vector: column index out of range");
+		return { static_cast<NthTypeOf<static_cast<size_t>(N), Ts...>*>(data_[N]), size_ };
+	}
+
+	template<typename... Ts>
+	template<typename T, T N>
+	Details::SoaColumn<const NthTypeOf<static_cast<size_t>(N), Ts...>> soa_vector<List<Ts...>>::column(IntegralConstant<T, N>) const
+	{
+		static_assert(N >= 0 && static_cast<size_t>(N) < sizeof...(Ts), "soa_vector: column index out of range");
+		return { static_cast<const NthTypeOf<static_cast<size_t>(N), Ts...>*>(data_[N]), size_ };
+	}
+
+	template<typename... Ts>
+	void soa_vector<List<Ts...>>::swap(soa_vector& other) noexcept
+	{
+		std::swap(storage_, other.storage_);
+		std::swap(data_, other.data_);
+		std::swap(size_, other.size_);
+		std::swap(capacity_, other.capacity_);
+	}
+
+	template<typename... Ts>
+	constexpr size_t soa_vector<List<Ts...>>::alignment()
+	{
+		const size_t alignments[] = { static_cast<size_t>(Tag<Ts>::alignment())... };
+		size_t result = 64;
+		for (size_t column_alignment : alignments)
+			if (column_alignment > result)
+				result = column_alignment;
+		return result;
+	}
+
+	template<typename... Ts>
+	size_t soa_vector<List<Ts...>>::layout(size_t capacity, size_t (&offsets)[sizeof...(Ts)])
+	{
+		const size_t sizes[] = { static_cast<size_t>(Tag<Ts>::size())... };
+		size_t bytes = 0;
+		for (size_t i = 0; i < sizeof...(Ts); ++i)
+		{
+			offsets[i] = bytes;
+			bytes += (sizes[i] * capacity + alignment() - 1) / alignment() * alignment();
+		}
+		return bytes;
+	}
+
+	template<typename... Ts>
+	template<size_t... Ns>
+	void soa_vector<List<Ts...>>::reallocate(size_t capacity, std::index_sequence<Ns...>)
+	{
+		size_t offsets[sizeof...(Ts)];
+		void* storage = ::operator new(layout(capacity, offsets) + alignment() - 1);
+		const std::uintptr_t base = (reinterpret_cast<std::uintptr_t>(storage) + alignment() - 1) / alignment() * alignment();
+		void* data[] = { reinterpret_cast<void*>(base + offsets[Ns])... };
+
+		using Expand = int[];
+		(void)Expand{ 0, (Details::relocate_column(static_cast<Ts*>(data_[Ns]), size_, static_cast<Ts*>(data[Ns]), std::is_trivially_copyable<Ts>{}), 0)... };
+
+		::operator delete(storage_);
+		storage_ = storage;
+		std::memcpy(data_, data, sizeof(data_));
+		capacity_ = capacity;
+	}
+
+	template<typename... Ts>
+	template<size_t... Ns, typename... Us>
+	void soa_vector<List<Ts...>>::construct_row(std::index_sequence<Ns...>, Us&&... values)
+	{
+		// Destroys the columns already constructed if a later one throws
+		struct Rollback
+		{
+			soa_vector& vector;
+			size_t constructed;
+
+			~Rollback()
+			{
+				if (constructed == sizeof...(Ts))
+					return;
+				using Expand = int[];
+				(void)Expand{ 0, (Ns < constructed ? Details::destroy_column(static_cast<Ts*>(vector.data_[Ns]), vector.size_, vector.size_ + 1, std::is_trivially_destructible<Ts>{}) : void(), 0)... };
+			}
+		} rollback{ *this, 0 };
+
+		using Expand = int[];
+		(void)Expand{ 0, (::new (static_cast<void*>(static_cast<Ts*>(data_[Ns]) + size_)) Ts(std::forward<Us>(values)), ++rollback.constructed, 0)... };
+		++size_;
+	}
+
+	template<typename... Ts>
+	template<size_t... Ns>
+	void soa_vector<List<Ts...>>::copy_rows(const soa_vector& other, std::index_sequence<Ns...>, BoolConstantTrue)
+	{
+		using Expand = int[];
+		(void)Expand{ 0, (Details::relocate_column(static_cast<Ts*>(other.data_[Ns]), other.size_, static_cast<Ts*>(data_[Ns]), std::true_type{}), 0)... };
+		size_ = other.size_;
+	}
+
+	template<typename... Ts>
+	template<size_t... Ns>
+	void soa_vector<List<Ts...>>::copy_rows(const soa_vector& other, std::index_sequence<Ns...>, BoolConstantFalse)
+	{
+		for (size_t row = 0; row < other.size_; ++row)
+			construct_row(Columns{}, static_cast<const Ts*>(other.data_[Ns])[row]...);
+	}
+
+	template<typename... Ts>
+	template<size_t... Ns>
+	void soa_vector<List<Ts...>>::destroy_rows(size_t first, size_t last, std::index_sequence<Ns...>)
+	{
+		using Expand = int[];
+		(void)Expand{ 0, (Details::destroy_column(static_cast<Ts*>(data_[Ns]), first, last, std::is_trivially_destructible<Ts>{}), 0)... };
+	}
+
+	template<typename... Ts>
+	void soa_vector<List<Ts...>>::grow_for(size_t count)
+	{
+		if (count <= capacity_)
+			return;
+		const size_t doubled = capacity_ * 2;
+		reallocate(count > doubled ? count : (doubled > 16 ? doubled : 16), Columns{});
+	}
+
+	/** Struct of arrays **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
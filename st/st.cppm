@@ -0,0 +1,187 @@
+// C++20 module interface unit: `import ST;` in place of #include "simpletemplate.hpp".
+// Macros such as TOTYPE and ST_FIELD do not cross module boundaries; include the headers for them.
+module;
+// The library is included in the global module fragment and only its public names are exported below. ST::Details
+// stays internal, and the std::tuple_size and std::tuple_element specializations of packed_tuple are reachable from
+// importers without being exported. Exporting using-declarations of global module entities needs a compiler that
+// implements them, such as GCC 14 or Clang 16; GCC 12 does not.
+#include "simpletemplate.hpp"
+
+export module ST;
+
+export namespace ST
+{
+	// st/integral.hpp
+	using ST::IntegralConstant;
+	using ST::BoolConstant;
+	using ST::BoolConstantTrue;
+	using ST::BoolConstantFalse;
+	using ST::true_c;
+	using ST::false_c;
+	using ST::Constant;
+	using ST::constant;
+	using ST::operator""_c;
+	using ST::operator""_C;
+	using ST::operator""_uc;
+	using ST::operator""_UC;
+	using ST::operator==;
+	using ST::operator!=;
+	using ST::operator<;
+	using ST::operator<=;
+	using ST::operator>;
+	using ST::operator>=;
+	using ST::operator+;
+	using ST::operator-;
+	using ST::operator*;
+	using ST::operator/;
+	using ST::operator%;
+	using ST::operator~;
+	using ST::operator^;
+	using ST::operator&;
+	using ST::operator|;
+	using ST::operator<<;
+	using ST::operator>>;
+	using ST::operator!;
+	using ST::operator&&;
+	using ST::operator||;
+	using ST::select;
+
+	// st/category.hpp
+	using ST::TypeCategoryTagBase;
+	using ST::VoidTag;
+	using ST::void_tag;
+	using ST::NullptrTag;
+	using ST::nullptr_tag;
+	using ST::IntegralTag;
+	using ST::integral_tag;
+	using ST::FloatingPointTag;
+	using ST::floating_point_tag;
+	using ST::ArrayTag;
+	using ST::array_tag;
+	using ST::EnumTag;
+	using ST::enum_tag;
+	using ST::UnionTag;
+	using ST::union_tag;
+	using ST::ClassTag;
+	using ST::class_tag;
+	using ST::FunctionTag;
+	using ST::function_tag;
+	using ST::PointerTag;
+	using ST::pointer_tag;
+	using ST::ReferenceTag;
+	using ST::reference_tag;
+	using ST::LValueReferenceTag;
+	using ST::lvalue_reference_tag;
+	using ST::RValueReferenceTag;
+	using ST::rvalue_reference_tag;
+	using ST::PointerToMemberObjectTag;
+	using ST::pointer_to_member_object_tag;
+	using ST::PointerToMemberFunctionTag;
+	using ST::pointer_to_member_function_tag;
+	using ST::type_category;
+	using ST::TypeCategory;
+
+	// st/tag.hpp
+	using ST::None;
+	using ST::none;
+	using ST::StringView;
+	using ST::enum_underlying_type;
+	using ST::sizeof_type;
+	using ST::alignof_type;
+	using ST::type_name;
+	using ST::type_hash;
+	using ST::countoftypes;
+	using ST::Tag;
+	using ST::tag;
+	using ST::PartialTag;
+	using ST::partialtypetag;
+	using ST::ConstQualifierTag;
+	using ST::const_qualifier_tag;
+	using ST::create;
+
+	// st/list.hpp
+	using ST::NthTypeOf;
+	using ST::List;
+	using ST::list;
+	using ST::list_first_or_default;
+	using ST::list_without_first;
+	using ST::ListPair;
+	using ST::reverse;
+	using ST::take;
+	using ST::drop;
+	using ST::split_at;
+	using ST::rotate;
+	using ST::slice;
+	using ST::contains;
+	using ST::index_of;
+	using ST::unique;
+	using ST::set_union;
+	using ST::set_intersection;
+	using ST::set_difference;
+	using ST::sort;
+	using ST::SizeKey;
+	using ST::size_key;
+	using ST::AlignmentKey;
+	using ST::alignment_key;
+	using ST::HashKey;
+	using ST::hash_key;
+	using ST::ListGroup;
+	using ST::transform;
+	using ST::filter;
+	using ST::partition;
+	using ST::group_by;
+	using ST::CategoryKey;
+	using ST::category_key;
+	using ST::combine;
+
+	// st/callable.hpp
+	using ST::function_return_type;
+	using ST::function_parameter_types;
+	using ST::param_type_of;
+	using ST::ParamType;
+
+	// st/loop.hpp
+	using ST::static_for;
+	using ST::static_for_each;
+
+	// st/dispatch.hpp
+	using ST::TableDispatchTag;
+	using ST::table_dispatch;
+	using ST::SwitchDispatchTag;
+	using ST::switch_dispatch;
+	using ST::dispatch;
+
+	// st/soa.hpp, st/inplace_function.hpp
+	using ST::soa_vector;
+	using ST::default_inplace_capacity;
+	using ST::inplace_function;
+	using ST::inplace_any;
+	using ST::swap;
+
+	// st/packed_tuple.hpp, st/type_map.hpp, st/variant.hpp
+	using ST::packed_tuple;
+	using ST::type_map;
+	using ST::variant;
+
+	// st/bulk.hpp
+	using ST::TriviallyRelocatable;
+	using ST::relocate;
+	using ST::copy_n;
+	using ST::fill_n;
+
+	// st/fields.hpp
+	using ST::LittleEndianTag;
+	using ST::little_endian;
+	using ST::BigEndianTag;
+	using ST::big_endian;
+	using ST::NativeEndianTag;
+	using ST::Fields;
+	using ST::fields;
+	using ST::FieldsView;
+	using ST::FieldArrayView;
+
+	// st/table.hpp
+	using ST::MinimalElementTag;
+	using ST::minimal_element;
+	using ST::make_table;
+}
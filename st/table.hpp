@@ -0,0 +1,217 @@
+#pragma once
+// make_table: constexpr lookup tables
+#include "integral.hpp"
+
+#include <array>
+
+namespace ST
+{
+	/*************************************************************************************************************/
+	/* Lookup tables */
+	// make_table<Extents...>(fn) is a std::array holding fn(i) at [i], nested once per extent, with fn taking one
+	// index per extent: make_table<4, 256>(fn) holds fn(i, j) at [i][j]. The values are computed by a relaxed
+	// constexpr loop, so a constexpr table is constant initialized and placed in read-only data.
+
+	// Stores the values as the smallest integral type that holds all of them. fn must be an integral valued,
+	// stateless function object whose type is an empty, default constructible literal type: the values are
+	// computed from F{} in a constant expression, since fn itself is not one.
+	_ST_INLINE_VAR constexpr struct MinimalElementTag {} minimal_element = {};
+
+	template<size_t... Extents, typename F>
+	constexpr auto make_table(const F& fn);
+
+	template<size_t... Extents, typename F>
+	constexpr auto make_table(const F& fn, MinimalElementTag);
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Lookup tables **/
+
+		template<typename T, size_t... Extents>
+		struct TableOf
+		{
+			using Type = T;
+		};
+
+		template<typename T, size_t Extent, size_t... Extents>
+		struct TableOf<T, Extent, Extents...>
+		{
+			using Type = std::array<typename TableOf<T, Extents...>::Type, Extent>;
+		};
+
+		template<typename F, size_t... Extents>
+		using TableResult = std::decay_t<decltype(std::declval<const F&>()(static_cast<size_t>(Extents)...))>;
+
+		template<size_t... Extents>
+		constexpr size_t table_size()
+		{
+			constexpr size_t extents[] = { Extents... };
+			size_t size = 1;
+			for (size_t extent : extents)
+				size *= extent;
+			return size;
+		}
+
+		// The values in row-major order. std::array cannot be written to in C++14 constant expressions, a member array can.
+		template<typename T, size_t Size>
+		struct TableValues
+		{
+			T values[Size];
+
+			constexpr T min() const
+			{
+				T result = values[0];
+				for (const T& value : values)
+					result = value < result ? value : result;
+				return result;
+			}
+
+			constexpr T max() const
+			{
+				T result = values[0];
+				for (const T& value : values)
+					result = result < value ? value : result;
+				return result;
+			}
+		};
+
+		template<typename T, size_t... Extents, typename F, size_t... Dimensions>
+		constexpr auto table_values(const F& fn, std::index_sequence<Dimensions...>)
+		{
+			static_assert(sizeof...(Extents) > 0 && table_size<Extents...>() > 0, "make_table: every extent must be positive");
+			constexpr size_t extents[] = { Extents... };
+			TableValues<T, table_size<Extents...>()> table{};
+			size_t index[sizeof...(Extents)] = {};
+			for (T& value : table.values)
+			{
+				value = fn(index[Dimensions]...);
+				// Next row-major index, the last dimension moving fastest
+				for (size_t d = sizeof...(Extents); d-- > 0 && ++index[d] == extents[d];)
+					index[d] = 0;
+			}
+			return table;
+		}
+
+#if defined(__cpp_lib_array_constexpr) && __cpp_lib_array_constexpr >= 201603L
+		// std::array is writable in constant expressions: copy the values in with loops too
+		template<typename T, size_t... Extents>
+		struct TableBuilder;
+
+		template<typename T, size_t Extent>
+		struct TableBuilder<T, Extent>
+		{
+			template<typename U>
+			static constexpr void copy(std::array<T, Extent>& table, const U* source)
+			{
+				for (size_t i = 0; i < Extent; ++i)
+					table[i] = static_cast<T>(source[i]);
+			}
+		};
+
+		template<typename T, size_t Extent, size_t Next, size_t... Extents>
+		struct TableBuilder<T, Extent, Next, Extents...>
+		{
+			using Row = TableBuilder<T, Next, Extents...>;
+
+			template<typename U>
+			static constexpr void copy(typename TableOf<T, Extent, Next, Extents...>::Type& table, const U* source)
+			{
+				for (size_t i = 0; i < Extent; ++i)
+					Row::copy(table[i], source + i * table_size<Next, Extents...>());
+			}
+		};
+
+		template<typename T, size_t... Extents, typename U, size_t Size>
+		constexpr auto build_table(const TableValues<U, Size>& source)
+		{
+			typename TableOf<T, Extents...>::Type table{};
+			TableBuilder<T, Extents...>::copy(table, source.values);
+			return table;
+		}
+#else
+		// One aggregate initialization per row
+		template<typename T, size_t... Extents>
+		struct TableBuilder;
+
+		template<typename T, size_t Extent>
+		struct TableBuilder<T, Extent>
+		{
+			template<typename U, size_t Size, size_t... Is>
+			static constexpr std::array<T, Extent> build(const TableValues<U, Size>& source, size_t offset, std::index_sequence<Is...>)
+			{
+				return {{ static_cast<T>(source.values[offset + Is])... }};
+			}
+		};
+
+		template<typename T, size_t Extent, size_t Next, size_t... Extents>
+		struct TableBuilder<T, Extent, Next, Extents...>
+		{
+			using Row = TableBuilder<T, Next, Extents...>;
+
+			template<typename U, size_t Size, size_t... Is>
+			static constexpr typename TableOf<T, Extent, Next, Extents...>::Type
+				build(const TableValues<U, Size>& source, size_t offset, std::index_sequence<Is...>)
+			{
+				return {{ Row::build(source, offset + Is * table_size<Next, Extents...>(), std::make_index_sequence<Next>{})... }};
+			}
+		};
+
+		template<typename T, size_t Extent, size_t... Extents, typename U, size_t Size>
+		constexpr auto build_table(const TableValues<U, Size>& source)
+		{
+			return TableBuilder<T, Extent, Extents...>::build(source, 0, std::make_index_sequence<Extent>{});
+		}
+#endif
+
+		// Smallest integral type holding every value of [Min, Max]
+		template<typename T, T Min, T Max, bool Negative = (Min < T{})>
+		struct MinimalElement
+		{
+			using Type = typename minimal_unsigned_integral_type<static_cast<WidestUInt>(Max)>::Type;
+		};
+
+		template<typename T, T Min, T Max>
+		struct MinimalElement<T, Min, Max, true>
+		{
+			using Low = typename minimal_integral_type<static_cast<WidestInt>(Min)>::Type;
+			using High = typename minimal_integral_type<static_cast<WidestInt>(Max)>::Type;
+			using Type = std::conditional_t<(sizeof(Low) < sizeof(High)), High, Low>;
+		};
+
+		/** Lookup tables **/
+
+	} // namespace Details
+
+	/** Lookup tables **/
+
+	template<size_t... Extents, typename F>
+	constexpr auto make_table(const F& fn)
+	{
+		using T = Details::TableResult<F, Extents...>;
+		using Dimensions = std::make_index_sequence<sizeof...(Extents)>;
+		return Details::build_table<T, Extents...>(Details::table_values<T, Extents...>(fn, Dimensions{}));
+	}
+
+	template<size_t... Extents, typename F>
+	constexpr auto make_table(const F&, MinimalElementTag)
+	{
+		using R = Details::TableResult<F, Extents...>;
+		static_assert(std::is_integral<R>::value, "make_table: minimal_element needs integral values");
+		static_assert(std::is_empty<F>::value && std::is_default_constructible<F>::value,
+			"make_table: minimal_element needs a stateless function object, computed as F{}");
+		using Dimensions = std::make_index_sequence<sizeof...(Extents)>;
+		constexpr auto values = Details::table_values<R, Extents...>(F{}, Dimensions{});
+		using T = typename Details::MinimalElement<R, values.min(), values.max()>::Type;
+		return Details::build_table<T, Extents...>(values);
+	}
+
+	/** Lookup tables **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
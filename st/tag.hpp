@@ -0,0 +1,420 @@
+#pragma once
+// Tag<T>, the type as a value, and its traits
+#include "category.hpp"
+
+namespace ST
+{
+#define POSSIBLE_RETURN(...) auto
+
+	/*************************************************************************************************************/
+	/* None tag */
+
+	struct None {};
+
+	_ST_INLINE_VAR constexpr None none = {};
+
+	template<typename T>
+	constexpr BoolConstantFalse operator==(None, T&&) { return {}; }
+
+	template<typename T>
+	constexpr BoolConstantFalse operator==(T&&, None) { return {}; }
+
+	constexpr BoolConstantTrue operator==(None, None) { return {}; }
+
+	template<typename T>
+	constexpr BoolConstantTrue operator!=(None, T&&) { return {}; }
+
+	template<typename T>
+	constexpr BoolConstantTrue operator!=(T&&, None) { return {}; }
+
+	constexpr BoolConstantFalse operator!=(None, None) { return {}; }
+
+	/*************************************************************************************************************/
+	/* Constant string view */
+	// Non-owning view of characters with static storage, usable in constant expressions.
+	// Converts to any string type constructible from (const char*, size_t), such as std::string_view.
+
+	class StringView
+	{
+	public:
+		constexpr StringView() = default;
+		constexpr StringView(const char* data, size_t size) : data_(data), size_(size) {}
+
+		constexpr const char* data() const { return data_; }
+		constexpr size_t size() const { return size_; }
+		constexpr bool empty() const { return size_ == 0; }
+		constexpr const char* begin() const { return data_; }
+		constexpr const char* end() const { return data_ + size_; }
+		constexpr char operator[](size_t index) const { return data_[index]; }
+
+		constexpr StringView substr(size_t position, size_t count) const { return { data_ + position, count }; }
+
+		template<typename S, typename = std::enable_if_t<std::is_constructible<S, const char*, size_t>::value>>
+		operator S() const { return S(data_, size_); }
+
+	private:
+		const char* data_ = "";
+		size_t size_ = 0;
+	};
+
+	constexpr bool operator==(StringView a, StringView b)
+	{
+		if (a.size() != b.size())
+			return false;
+		for (size_t i = 0; i < a.size(); ++i)
+			if (a[i] != b[i])
+				return false;
+		return true;
+	}
+
+	constexpr bool operator!=(StringView a, StringView b) { return !(a == b); }
+
+	template<size_t N>
+	constexpr bool operator==(StringView a, const char (&b)[N]) { return a == StringView(b, N - 1); }
+	template<size_t N>
+	constexpr bool operator==(const char (&a)[N], StringView b) { return StringView(a, N - 1) == b; }
+	template<size_t N>
+	constexpr bool operator!=(StringView a, const char (&b)[N]) { return !(a == b); }
+	template<size_t N>
+	constexpr bool operator!=(const char (&a)[N], StringView b) { return !(a == b); }
+
+	/*************************************************************************************************************/
+	/* Type properties */
+	template<typename E>
+	constexpr POSSIBLE_RETURN(None, Tag<...>) enum_underlying_type();
+
+	template<typename T>
+	constexpr auto sizeof_type();
+
+	template<typename T>
+	constexpr auto alignof_type();
+
+	template<typename T>
+	constexpr StringView type_name();
+
+	template<typename T>
+	constexpr auto type_hash();
+
+	template<typename... Ts>
+	constexpr IntegralConstant<size_t, sizeof...(Ts)> countoftypes = {};
+
+	/*************************************************************************************************************/
+	/* type tag */
+
+	template<typename T>
+	struct Tag
+	{
+		using Type = T;
+
+		//generic traits
+		static constexpr POSSIBLE_RETURN(None, IntegralConstant<...>) size();
+		static constexpr POSSIBLE_RETURN(None, IntegralConstant<...>) alignment();
+
+		// The type as spelled by the compiler, e.g. "const int*" or "std::vector<int>"; without RTTI
+		static constexpr StringView name();
+		// 64-bit FNV-1a hash of name(), as IntegralConstant<std::uint64_t, ...>
+		static constexpr auto hash();
+		static constexpr
+			POSSIBLE_RETURN(VoidTag, NullptrTag, IntegralTag, FloatingPointTag, EnumTag,
+				UnionTag, ClassTag, FunctionTag, PointerTag, LValueReferenceTag,
+				RValueReferenceTag, PointerToMemberObjectTag, PointerToMemberFunctionTag)
+			category();
+
+		//enum traits
+		static constexpr POSSIBLE_RETURN(None, Tag<...>) underlying_type();
+
+		//function traits, defined in st/callable.hpp
+		static constexpr POSSIBLE_RETURN(None, Tag<...>) return_type();
+		static constexpr POSSIBLE_RETURN(None, List<...>) parameter_types();
+
+		//parameter passing, defined in st/callable.hpp
+		static constexpr POSSIBLE_RETURN(None, Tag<...>) param_type();
+	};
+
+	// These are left undefined for preventing wrong usage: the type is already a type tag
+	template<typename T> struct Tag<Tag<T>>;
+	template<typename T> struct Tag<Tag<T>&>;
+	template<typename T> struct Tag<const Tag<T>>;
+	template<typename T> struct Tag<const Tag<T>&>;
+
+	template<typename T>
+	constexpr Tag<T> tag = {};
+
+#define TOTYPE(TAG) typename std::decay_t<decltype(TAG)>::Type
+
+	/*************************************************************************************************************/
+	/* partial type tag */
+
+	template<template<typename...> class PartialT>
+	struct PartialTag
+	{};
+
+	template<template<typename...> class PartialT>
+	constexpr PartialTag<PartialT> partialtypetag = {};
+
+	/*************************************************************************************************************/
+	/* Type equality comparison */
+
+	template<typename T>
+	constexpr BoolConstantTrue operator==(Tag<T>, Tag<T>) { return {}; }
+	template<typename T1, typename T2>
+	constexpr BoolConstantFalse operator==(Tag<T1>, Tag<T2>) { return {}; }
+	template<typename T>
+	constexpr BoolConstantFalse operator!=(Tag<T>, Tag<T>) { return {}; }
+	template<typename T1, typename T2>
+	constexpr BoolConstantTrue operator!=(Tag<T1>, Tag<T2>) { return {}; }
+
+	/*************************************************************************************************************/
+	/* type operators */
+
+	template<typename T>
+	constexpr Tag<T&> operator+ (Tag<T>, LValueReferenceTag) { return {}; }
+
+	template<typename T>
+	constexpr Tag<T&&> operator+ (Tag<T>, RValueReferenceTag) { return {}; }
+
+	template<typename T>
+	constexpr Tag<T> operator- (Tag<T>, ReferenceTag) { return {}; }
+	template<typename T>
+	constexpr Tag<T> operator- (Tag<T&>, ReferenceTag) { return {}; }
+	template<typename T>
+	constexpr Tag<T> operator- (Tag<T&>, LValueReferenceTag) { return {}; }
+	template<typename T>
+	constexpr Tag<T> operator- (Tag<T&>, RValueReferenceTag) = delete;
+	template<typename T>
+	constexpr Tag<T> operator- (Tag<T&&>, ReferenceTag) { return {}; }
+	template<typename T>
+	constexpr Tag<T> operator- (Tag<T&&>, LValueReferenceTag) = delete;
+	template<typename T>
+	constexpr Tag<T> operator- (Tag<T&&>, RValueReferenceTag) { return {}; }
+
+	_ST_INLINE_VAR constexpr struct ConstQualifierTag {} const_qualifier_tag = {};
+
+	template<typename T>
+	constexpr Tag<const T> operator+ (Tag<T>, ConstQualifierTag) { return {}; }
+
+	template<typename T>
+	constexpr Tag<const T&> operator+ (Tag<T&>, ConstQualifierTag) { return {}; }
+
+	template<typename T>
+	constexpr Tag<const T&&> operator+ (Tag<T&&>, ConstQualifierTag) { return {}; }
+
+	template<typename T>
+	constexpr Tag<T> operator- (Tag<T>, ConstQualifierTag) { return {}; }
+
+	template<typename T>
+	constexpr Tag<T> operator- (Tag<const T>, ConstQualifierTag) { return {}; }
+
+	template<typename T>
+	constexpr Tag<T&> operator- (Tag<const T&>, ConstQualifierTag) { return {}; }
+
+	template<typename T>
+	constexpr Tag<T&&> operator- (Tag<const T&&>, ConstQualifierTag) { return {}; }
+
+	template<typename T>
+	constexpr Tag<std::add_pointer_t<T>> operator+ (Tag<T>, PointerTag) { return{}; }
+
+	template<typename T>
+	constexpr Tag<std::remove_pointer_t<T>> operator- (Tag<T>, PointerTag) { return{}; }
+
+	/*************************************************************************************************************/
+	/* Misc */
+
+	template<typename T, typename ... ArgsT>
+	inline auto create(Tag<T>, ArgsT&& ... args)
+	{
+		return T{ std::forward<ArgsT>(args)... };
+	}
+
+#undef POSSIBLE_RETURN
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Primitive integral constant support **/
+
+		template<typename T>
+		struct SizeOfTypeImpl
+		{
+			static constexpr auto size = IntegralConstant<size_t, sizeof(T)>{};
+		};
+
+		template<typename T>
+		struct SizeOfTypeImpl<T[]>
+		{
+			static constexpr auto size = none;
+		};
+
+		template<>
+		struct SizeOfTypeImpl<void>
+		{
+			static constexpr auto size = none;
+		};
+
+		template<typename T>
+		struct AlignOfTypeImpl
+		{
+			static constexpr auto alignment = IntegralConstant<size_t, alignof(T)>{};
+		};
+
+		template<>
+		struct AlignOfTypeImpl<void>
+		{
+			static constexpr auto alignment = none;
+		};
+
+		/** Primitive integral constant support **/
+
+		/** Type names **/
+
+		// The signature of this function spells T; the part around it is the same for every T
+		template<typename T>
+		constexpr StringView type_signature()
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			return { __FUNCSIG__, sizeof(__FUNCSIG__) - 1 };
+#else
+			return { __PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1 };
+#endif
+		}
+
+		// Position of the last "int" in the signature for int, which is where every compiler spells T
+		constexpr size_t type_name_prefix(StringView probe)
+		{
+			size_t position = probe.size() - 3;
+			while (position > 0 && !(probe[position] == 'i' && probe[position + 1] == 'n' && probe[position + 2] == 't'))
+				--position;
+			return position;
+		}
+
+		template<typename T>
+		constexpr StringView parse_type_name()
+		{
+			const StringView probe = type_signature<int>();
+			const size_t prefix = type_name_prefix(probe);
+			const size_t suffix = probe.size() - prefix - 3;
+			const StringView signature = type_signature<T>();
+			return signature.substr(prefix, signature.size() - prefix - suffix);
+		}
+
+		// Constant initialized: reading a name costs nothing at run time
+		template<typename T>
+		constexpr StringView type_name = parse_type_name<T>();
+
+		constexpr std::uint64_t fnv1a(StringView text)
+		{
+			std::uint64_t hash = 14695981039346656037ull;
+			for (char c : text)
+				hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+			return hash;
+		}
+
+		// Finalizer of splitmix64
+		constexpr std::uint64_t mix_hash(std::uint64_t z)
+		{
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			return z ^ (z >> 31);
+		}
+
+		/** Type names **/
+
+		/** Enum traits **/
+
+		template<typename E, typename = TypeCategory<E>>
+		struct UnderlyingTypeImpl
+		{
+			static constexpr auto tag = none;
+		};
+
+		template<typename E>
+		struct UnderlyingTypeImpl<E, EnumTag>
+		{
+			static constexpr auto tag = ST::tag<std::underlying_type_t<E>>;
+		};
+
+		/** Enum traits **/
+
+	} // namespace Details
+
+	/** Free functions **/
+
+	template<typename T>
+	constexpr auto sizeof_type()
+	{
+		return Details::SizeOfTypeImpl<T>::size;
+	}
+
+	template<typename T>
+	constexpr auto alignof_type()
+	{
+		return Details::AlignOfTypeImpl<T>::alignment;
+	}
+
+	template<typename T>
+	constexpr StringView type_name()
+	{
+		return Details::type_name<T>;
+	}
+
+	template<typename T>
+	constexpr auto type_hash()
+	{
+		return IntegralConstant<std::uint64_t, Details::fnv1a(Details::type_name<T>)>{};
+	}
+
+	template<typename E>
+	constexpr auto enum_underlying_type()
+	{
+		return Details::UnderlyingTypeImpl<E>::tag;
+	}
+
+	/** Free functions **/
+
+	/** struct Tag **/
+
+	template<typename T> constexpr auto Tag<T>::size()
+	{
+		_ST_INSTRUMENT("tag.size", 0);
+		return sizeof_type<T>();
+	}
+
+	template<typename T> constexpr auto Tag<T>::alignment()
+	{
+		_ST_INSTRUMENT("tag.alignment", 0);
+		return alignof_type<T>();
+	}
+
+	template<typename T> constexpr StringView Tag<T>::name()
+	{
+		_ST_INSTRUMENT("tag.name", 0);
+		return type_name<T>();
+	}
+
+	template<typename T> constexpr auto Tag<T>::hash()
+	{
+		_ST_INSTRUMENT("tag.hash", 0);
+		return type_hash<T>();
+	}
+
+	template<typename T> constexpr auto Tag<T>::category()
+	{
+		_ST_INSTRUMENT("tag.category", 0);
+		return type_category<Type>();
+	}
+
+	template<typename T> constexpr auto Tag<T>::underlying_type()
+	{
+		_ST_INSTRUMENT("tag.underlying_type", 0);
+		return enum_underlying_type<T>();
+	}
+
+	/** struct Tag **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
@@ -0,0 +1,255 @@
+#pragma once
+// type_map: one value per type of a list, also found by type hash
+#include "list.hpp"
+
+namespace ST
+{
+	/*************************************************************************************************************/
+	/* Type map */
+	// type_map<List<Ts...>, V> is a flat array with one V per type. m[tag<T>] is a constant offset. m.find(hash)
+	// looks up by Tag<T>::hash() through a perfect hash built at compile time: two loads and one comparison.
+
+	namespace Details
+	{
+		template<typename... Ts>
+		struct TypeHashIndex;
+	}
+
+	template<typename L, typename V>
+	class type_map;
+
+	template<typename... Ts, typename V>
+	class type_map<List<Ts...>, V>
+	{
+	public:
+		static_assert(sizeof...(Ts) > 0, "type_map: empty list");
+		// Hash collisions are only detected by find, which builds the perfect hash
+		static_assert(static_cast<size_t>(decltype(unique(List<Ts...>{}))::length) == sizeof...(Ts),
+			"type_map: duplicate type");
+
+		static constexpr IntegralConstant<size_t, sizeof...(Ts)> length = {};
+
+		// Values are value-initialized
+		type_map() : values_() {}
+
+		template<typename T>
+		V& operator[](Tag<T>);
+		template<typename T>
+		const V& operator[](Tag<T>) const;
+
+		// The value of the type whose Tag<T>::hash() is hash, or nullptr
+		V* find(std::uint64_t hash);
+		const V* find(std::uint64_t hash) const;
+		// m.find(tag<T>.hash()): the same lookup, at run time, for a hash known at compile time
+		template<std::uint64_t Hash>
+		V* find(IntegralConstant<std::uint64_t, Hash>);
+		template<std::uint64_t Hash>
+		const V* find(IntegralConstant<std::uint64_t, Hash>) const;
+
+		// Values in the order of the list
+		V* begin() { return values_; }
+		V* end() { return values_ + sizeof...(Ts); }
+		const V* begin() const { return values_; }
+		const V* end() const { return values_ + sizeof...(Ts); }
+
+	private:
+		V values_[sizeof...(Ts)];
+	};
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Type map **/
+
+		// Hash and displace: keys are spread into buckets, and each bucket, largest first, gets the first seed that
+		// sends all of its keys to free slots. Slots are at most three quarters full.
+		constexpr size_t power_of_two_at_least(size_t n)
+		{
+			size_t result = 1;
+			while (result < n)
+				result *= 2;
+			return result;
+		}
+
+		template<size_t N>
+		struct PerfectHashShape
+		{
+			static constexpr size_t buckets = power_of_two_at_least(N / 2 + 1);
+			static constexpr size_t slots = power_of_two_at_least(N + N / 3 + 1);
+
+			static constexpr size_t bucket(std::uint64_t hash) { return static_cast<size_t>(mix_hash(hash) >> 32) & (buckets - 1); }
+
+			static constexpr size_t slot(std::uint64_t hash, std::uint32_t seed)
+			{
+				return static_cast<size_t>(mix_hash(hash ^ (seed * 0x9E3779B97F4A7C15ull))) & (slots - 1);
+			}
+		};
+
+		struct PerfectHashEntry
+		{
+			std::uint64_t hash;
+			size_t index; // N for a free slot
+		};
+
+		template<size_t N>
+		struct PerfectHashTable
+		{
+			using Shape = PerfectHashShape<N>;
+
+			std::uint32_t seeds[Shape::buckets];
+			PerfectHashEntry entries[Shape::slots];
+			bool valid; // false if two keys are equal
+		};
+
+		template<size_t N>
+		constexpr PerfectHashTable<N> build_perfect_hash(const std::uint64_t* hashes)
+		{
+			using Shape = PerfectHashShape<N>;
+			PerfectHashTable<N> table{};
+			table.valid = true;
+			for (size_t s = 0; s < Shape::slots; ++s)
+				table.entries[s] = { 0, N };
+
+			// Keys grouped by bucket: members[start[b], start[b + 1])
+			size_t start[Shape::buckets + 1] = {};
+			size_t members[N] = {};
+			size_t largest = 0;
+			for (size_t i = 0; i < N; ++i)
+				++start[Shape::bucket(hashes[i]) + 1];
+			for (size_t b = 0; b < Shape::buckets; ++b)
+			{
+				largest = start[b + 1] > largest ? start[b + 1] : largest;
+				start[b + 1] += start[b];
+			}
+			size_t filled[Shape::buckets] = {};
+			for (size_t i = 0; i < N; ++i)
+			{
+				const size_t b = Shape::bucket(hashes[i]);
+				members[start[b] + filled[b]++] = i;
+			}
+
+			for (size_t size = largest; size > 0; --size)
+			{
+				for (size_t b = 0; b < Shape::buckets; ++b)
+				{
+					if (start[b + 1] - start[b] != size)
+						continue;
+					for (size_t i = start[b]; i < start[b + 1]; ++i)
+						for (size_t j = start[b]; j < i; ++j)
+							if (hashes[members[i]] == hashes[members[j]])
+								table.valid = false;
+					if (!table.valid)
+						return table;
+
+					for (std::uint32_t seed = 0;; ++seed)
+					{
+						size_t placed = start[b];
+						while (placed < start[b + 1])
+						{
+							const size_t s = Shape::slot(hashes[members[placed]], seed);
+							if (table.entries[s].index != N)
+								break;
+							table.entries[s] = { hashes[members[placed]], members[placed] };
+							++placed;
+						}
+						if (placed == start[b + 1])
+						{
+							table.seeds[b] = seed;
+							break;
+						}
+						while (placed-- > start[b])
+							table.entries[Shape::slot(hashes[members[placed]], seed)] = { 0, N };
+					}
+				}
+			}
+			return table;
+		}
+
+		template<typename... Ts>
+		struct TypeHashIndex
+		{
+			using Shape = PerfectHashShape<sizeof...(Ts)>;
+
+			static constexpr PerfectHashTable<sizeof...(Ts)> build()
+			{
+				const std::uint64_t hashes[] = { static_cast<std::uint64_t>(Tag<Ts>::hash())... };
+				return build_perfect_hash<sizeof...(Ts)>(hashes);
+			}
+
+			static constexpr PerfectHashTable<sizeof...(Ts)> table = build();
+
+			static_assert(table.valid, "type_map: duplicate type, or two types with the same Tag<T>::hash()");
+
+			// Position of the type with this hash, or the length of the list
+			static size_t find(std::uint64_t hash)
+			{
+				const PerfectHashEntry& entry = table.entries[Shape::slot(hash, table.seeds[Shape::bucket(hash)])];
+				return entry.hash == hash ? entry.index : sizeof...(Ts);
+			}
+		};
+
+		template<typename... Ts>
+		constexpr PerfectHashTable<sizeof...(Ts)> TypeHashIndex<Ts...>::table;
+
+		/** Type map **/
+
+	} // namespace Details
+
+	/** Type map **/
+
+	template<typename... Ts, typename V>
+	constexpr IntegralConstant<size_t, sizeof...(Ts)> type_map<List<Ts...>, V>::length;
+
+	template<typename... Ts, typename V>
+	template<typename T>
+	V& type_map<List<Ts...>, V>::operator[](Tag<T>)
+	{
+		static_assert(Details::list_contains<T, Ts...>, "type_map: type not in the list");
+		return values_[static_cast<size_t>(decltype(Details::position_of<T>(Details::IndexedTypesOf<Ts...>{})){})];
+	}
+
+	template<typename... Ts, typename V>
+	template<typename T>
+	const V& type_map<List<Ts...>, V>::operator[](Tag<T>) const
+	{
+		static_assert(Details::list_contains<T, Ts...>, "type_map: type not in the list");
+		return values_[static_cast<size_t>(decltype(Details::position_of<T>(Details::IndexedTypesOf<Ts...>{})){})];
+	}
+
+	template<typename... Ts, typename V>
+	V* type_map<List<Ts...>, V>::find(std::uint64_t hash)
+	{
+		const size_t index = Details::TypeHashIndex<Ts...>::find(hash);
+		return index < sizeof...(Ts) ? values_ + index : nullptr;
+	}
+
+	template<typename... Ts, typename V>
+	const V* type_map<List<Ts...>, V>::find(std::uint64_t hash) const
+	{
+		const size_t index = Details::TypeHashIndex<Ts...>::find(hash);
+		return index < sizeof...(Ts) ? values_ + index : nullptr;
+	}
+
+	template<typename... Ts, typename V>
+	template<std::uint64_t Hash>
+	V* type_map<List<Ts...>, V>::find(IntegralConstant<std::uint64_t, Hash>)
+	{
+		return find(Hash);
+	}
+
+	template<typename... Ts, typename V>
+	template<std::uint64_t Hash>
+	const V* type_map<List<Ts...>, V>::find(IntegralConstant<std::uint64_t, Hash>) const
+	{
+		return find(Hash);
+	}
+
+	/** Type map **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST
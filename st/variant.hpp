@@ -0,0 +1,410 @@
+#pragma once
+// variant: a tagged union over the types of a list
+#include "dispatch.hpp"
+
+#include <new>
+
+namespace ST
+{
+	/*************************************************************************************************************/
+	/* Variant */
+	// variant<List<Ts...>> holds exactly one of the types of the list. The index is the smallest unsigned type that
+	// holds length - 1. When every alternative is a scalar by category (integral, floating point, enum, pointer,
+	// pointer to member or nullptr_t), copy, move and destruction are trivial. Every type must be nothrow move
+	// constructible; replacing the value never leaves the variant empty. Move assignment is noexcept when the move
+	// assignment of every type is; a type without move assignment is replaced instead. Copy construction is deleted unless every type is copy constructible, copy
+	// assignment unless every type is also copy assignable.
+
+	namespace Details
+	{
+		template<typename... Ts>
+		struct VariantBaseOf;
+
+		template<bool CopyConstructible, bool CopyAssignable>
+		struct VariantCopyControl;
+
+		template<typename T, typename Alternatives, typename... ArgsT>
+		struct VariantConstructible;
+	}
+
+	template<typename L>
+	class variant;
+
+	template<typename... Ts>
+	class variant<List<Ts...>> : private Details::VariantBaseOf<Ts...>::Type,
+		private Details::VariantCopyControl<Details::all_of<std::is_copy_constructible<Ts>::value...>,
+			Details::all_of<std::is_copy_constructible<Ts>::value && std::is_copy_assignable<Ts>::value...>>
+	{
+		using Base = typename Details::VariantBaseOf<Ts...>::Type;
+
+	public:
+		static_assert(sizeof...(Ts) > 0, "variant: empty list");
+		static_assert(Details::all_of<std::is_same<std::decay_t<Ts>, Ts>::value...>,
+			"variant: alternatives must be cv-unqualified, non-array object types");
+		static_assert(Details::all_of<std::is_nothrow_move_constructible<Ts>::value...>,
+			"variant: alternatives must be nothrow move constructible");
+
+		static constexpr IntegralConstant<size_t, sizeof...(Ts)> length = {};
+
+		// Holds a value-initialized first alternative
+		variant() : Base(tag<NthTypeOf<0, Ts...>>) {}
+
+		// Holds value; only takes part in overload resolution when its decayed type is one of the alternatives
+		template<typename T, typename = std::enable_if_t<Details::list_contains<std::decay_t<T>, Ts...>>>
+		variant(T&& value) : Base(tag<std::decay_t<T>>, std::forward<T>(value)) {}
+
+		// Holds a T constructed from args; only takes part in overload resolution when T is one of the alternatives
+		// and is constructible from args
+		template<typename T, typename... ArgsT,
+			typename = std::enable_if_t<Details::VariantConstructible<T, List<Ts...>, ArgsT...>::value>>
+		explicit variant(Tag<T> t, ArgsT&&... args) : Base(t, std::forward<ArgsT>(args)...) {}
+
+		template<typename T, typename = std::enable_if_t<Details::list_contains<std::decay_t<T>, Ts...>>>
+		variant& operator=(T&& value);
+
+		// Replaces the value with a T constructed from args; constrained as the constructor above
+		template<typename T, typename... ArgsT,
+			typename = std::enable_if_t<Details::VariantConstructible<T, List<Ts...>, ArgsT...>::value>>
+		T& emplace(Tag<T>, ArgsT&&... args);
+
+		// Position of the held type in the list
+		size_t index() const { return this->index_; }
+
+		template<typename T>
+		bool holds(Tag<T>) const;
+
+		// The value if it is a T, otherwise nullptr
+		template<typename T>
+		T* get_if(Tag<T>);
+		template<typename T>
+		const T* get_if(Tag<T>) const;
+
+		// f(value) for the held value, through a single jump table.
+		// f must return the same type for every alternative.
+		template<typename F>
+		decltype(auto) visit(F&& f) &;
+		template<typename F>
+		decltype(auto) visit(F&& f) const &;
+		template<typename F>
+		decltype(auto) visit(F&& f) &&;
+
+	private:
+		template<typename T, typename U>
+		void assign(Tag<T>, BoolConstantTrue /*assignable*/, U&& value);
+		template<typename T, typename U>
+		void assign(Tag<T>, BoolConstantFalse, U&& value);
+		template<typename T, typename... ArgsT>
+		T& replace(Tag<T>, BoolConstantTrue, ArgsT&&... args);
+		template<typename T, typename... ArgsT>
+		T& replace(Tag<T>, BoolConstantFalse, ArgsT&&... args);
+	};
+
+	/*************************************************************************************************************/
+	/* IMPLEMENTATION */
+	/*************************************************************************************************************/
+	namespace Details
+	{
+
+		/** Variant **/
+
+		template<typename... Ts>
+		constexpr size_t largest_size()
+		{
+			const size_t sizes[] = { sizeof(Ts)... };
+			size_t result = 0;
+			for (size_t size : sizes)
+				result = size > result ? size : result;
+			return result;
+		}
+
+		template<typename... Ts>
+		constexpr size_t largest_alignment()
+		{
+			const size_t alignments[] = { alignof(Ts)... };
+			size_t result = 1;
+			for (size_t alignment : alignments)
+				result = alignment > result ? alignment : result;
+			return result;
+		}
+
+		template<typename... Ts>
+		struct VariantStorage
+		{
+			using Index = typename minimal_unsigned_integral_type<sizeof...(Ts) - 1>::Type;
+
+			template<typename T>
+			static constexpr Index index_of(Tag<T>)
+			{
+				static_assert(list_contains<T, Ts...>, "variant: type not in the list");
+				return static_cast<Index>(static_cast<size_t>(decltype(position_of<T>(IndexedTypesOf<Ts...>{})){}));
+			}
+
+			VariantStorage() = default;
+
+			// Nothing is destroyed if the constructor of T throws
+			template<typename T, typename... ArgsT>
+			explicit VariantStorage(Tag<T> t, ArgsT&&... args)
+			{
+				construct(t, std::forward<ArgsT>(args)...);
+			}
+
+			template<typename T, typename... ArgsT>
+			T& construct(Tag<T> t, ArgsT&&... args)
+			{
+				T* value = ::new (static_cast<void*>(bytes_)) T(std::forward<ArgsT>(args)...);
+				index_ = index_of(t);
+				return *value;
+			}
+
+			template<typename T>
+			T* get(Tag<T>) { return static_cast<T*>(static_cast<void*>(bytes_)); }
+			template<typename T>
+			const T* get(Tag<T>) const { return static_cast<const T*>(static_cast<const void*>(bytes_)); }
+
+			// One jump table: a single switch up to switch_dispatch_width alternatives, a table of function pointers beyond
+			template<typename F>
+			static decltype(auto) visit_index(size_t index, F&& f)
+			{
+				return dispatch(List<Ts...>{}, index, std::forward<F>(f),
+					select(BoolConstant<(sizeof...(Ts) <= switch_dispatch_width)>{}, switch_dispatch, table_dispatch));
+			}
+
+			void copy_from(const VariantStorage& other)
+			{
+				visit_index(other.index_, [this, &other](auto t) { this->construct(t, *other.get(t)); });
+			}
+
+			void move_from(VariantStorage&& other) noexcept
+			{
+				visit_index(other.index_, [this, &other](auto t) { this->construct(t, std::move(*other.get(t))); });
+			}
+
+			alignas(largest_alignment<Ts...>()) unsigned char bytes_[largest_size<Ts...>()];
+			Index index_;
+		};
+
+		// Scalars only: every special member is implicit and trivial
+		template<bool Trivial, typename... Ts>
+		struct VariantBase : VariantStorage<Ts...>
+		{
+			using VariantStorage<Ts...>::VariantStorage;
+
+			void destroy() noexcept {}
+		};
+
+		template<typename... Ts>
+		struct VariantBase<false, Ts...> : VariantStorage<Ts...>
+		{
+			using VariantStorage<Ts...>::VariantStorage;
+
+			VariantBase(const VariantBase& other) : VariantStorage<Ts...>() { this->copy_from(other); }
+			VariantBase(VariantBase&& other) noexcept : VariantStorage<Ts...>() { this->move_from(std::move(other)); }
+
+			// The same alternative is assigned in place; another one is copied aside first
+			VariantBase& operator=(const VariantBase& other)
+			{
+				if (this->index_ == other.index_)
+					this->visit_index(this->index_, [this, &other](auto t) { *this->get(t) = *other.get(t); });
+				else
+				{
+					VariantBase copy(other);
+					destroy();
+					this->move_from(std::move(copy));
+				}
+				return *this;
+			}
+
+			// Noexcept only if every move assignable alternative has a nothrow move assignment, which the same
+			// alternative uses; the others are replaced by their nothrow move constructor
+			VariantBase& operator=(VariantBase&& other)
+				noexcept(all_of<(std::is_nothrow_move_assignable<Ts>::value || !std::is_move_assignable<Ts>::value)...>)
+			{
+				if (this->index_ == other.index_)
+					this->visit_index(this->index_, [this, &other](auto t) {
+						this->move_assign(t, BoolConstant<std::is_move_assignable<TOTYPE(t)>::value>{}, other);
+					});
+				else
+				{
+					destroy();
+					this->move_from(std::move(other));
+				}
+				return *this;
+			}
+
+			~VariantBase() { destroy(); }
+
+			template<typename T>
+			void move_assign(Tag<T> t, BoolConstantTrue /*assignable*/, VariantBase& other)
+			{
+				*this->get(t) = std::move(*other.get(t));
+			}
+
+			// Without a move assignment the value is replaced, which cannot throw
+			template<typename T>
+			void move_assign(Tag<T> t, BoolConstantFalse, VariantBase& other) noexcept
+			{
+				this->get(t)->~T();
+				this->construct(t, std::move(*other.get(t)));
+			}
+
+			void destroy() noexcept
+			{
+				this->visit_index(this->index_, [this](auto t) {
+					using T = TOTYPE(t);
+					this->get(t)->~T();
+				});
+			}
+		};
+
+		template<typename... Ts>
+		struct VariantBaseOf
+		{
+			using Type = VariantBase<all_of<is_scalar_category(TypeCategory<Ts>{})...>, Ts...>;
+		};
+
+		// T is one of the alternatives and constructible from ArgsT; the trait is only evaluated for alternatives
+		template<typename T, typename... Ts, typename... ArgsT>
+		struct VariantConstructible<T, List<Ts...>, ArgsT...>
+			: std::conditional_t<list_contains<T, Ts...>, std::is_constructible<T, ArgsT&&...>, std::false_type>
+		{};
+
+		// Empty base that deletes the copy members of variant which some alternative cannot perform, so that
+		// std::is_copy_constructible and std::is_copy_assignable tell the truth
+		template<bool CopyConstructible, bool CopyAssignable>
+		struct VariantCopyControl {};
+
+		template<>
+		struct VariantCopyControl<true, false>
+		{
+			VariantCopyControl() = default;
+			VariantCopyControl(const VariantCopyControl&) = default;
+			VariantCopyControl(VariantCopyControl&&) = default;
+			VariantCopyControl& operator=(const VariantCopyControl&) = delete;
+			VariantCopyControl& operator=(VariantCopyControl&&) = default;
+		};
+
+		template<>
+		struct VariantCopyControl<false, false>
+		{
+			VariantCopyControl() = default;
+			VariantCopyControl(const VariantCopyControl&) = delete;
+			VariantCopyControl(VariantCopyControl&&) = default;
+			VariantCopyControl& operator=(const VariantCopyControl&) = delete;
+			VariantCopyControl& operator=(VariantCopyControl&&) = default;
+		};
+
+		/** Variant **/
+
+	} // namespace Details
+
+	/** Variant **/
+
+	template<typename... Ts>
+	constexpr IntegralConstant<size_t, sizeof...(Ts)> variant<List<Ts...>>::length;
+
+	// The held alternative is assigned in place, which keeps its resources and allows value to refer to it
+	template<typename... Ts>
+	template<typename T, typename>
+	variant<List<Ts...>>& variant<List<Ts...>>::operator=(T&& value)
+	{
+		using U = std::decay_t<T>;
+		if (holds(tag<U>))
+			assign(tag<U>, BoolConstant<std::is_assignable<U&, T>::value>{}, std::forward<T>(value));
+		else
+			emplace(tag<U>, std::forward<T>(value));
+		return *this;
+	}
+
+	template<typename... Ts>
+	template<typename T, typename U>
+	void variant<List<Ts...>>::assign(Tag<T> t, BoolConstantTrue, U&& value)
+	{
+		*this->get(t) = std::forward<U>(value);
+	}
+
+	// Without an assignment operator the value is replaced
+	template<typename... Ts>
+	template<typename T, typename U>
+	void variant<List<Ts...>>::assign(Tag<T> t, BoolConstantFalse, U&& value)
+	{
+		emplace(t, std::forward<U>(value));
+	}
+
+	template<typename... Ts>
+	template<typename T, typename... ArgsT, typename>
+	T& variant<List<Ts...>>::emplace(Tag<T> t, ArgsT&&... args)
+	{
+		return replace(t, BoolConstant<std::is_nothrow_constructible<T, ArgsT...>::value>{}, std::forward<ArgsT>(args)...);
+	}
+
+	template<typename... Ts>
+	template<typename T, typename... ArgsT>
+	T& variant<List<Ts...>>::replace(Tag<T> t, BoolConstantTrue, ArgsT&&... args)
+	{
+		this->destroy();
+		return this->construct(t, std::forward<ArgsT>(args)...);
+	}
+
+	// The new value is built aside first, so that a throwing constructor leaves the old value in place
+	template<typename... Ts>
+	template<typename T, typename... ArgsT>
+	T& variant<List<Ts...>>::replace(Tag<T> t, BoolConstantFalse, ArgsT&&... args)
+	{
+		T value(std::forward<ArgsT>(args)...);
+		return replace(t, true_c, std::move(value));
+	}
+
+	template<typename... Ts>
+	template<typename T>
+	bool variant<List<Ts...>>::holds(Tag<T> t) const
+	{
+		return this->index_ == Base::index_of(t);
+	}
+
+	template<typename... Ts>
+	template<typename T>
+	T* variant<List<Ts...>>::get_if(Tag<T> t)
+	{
+		return holds(t) ? this->get(t) : nullptr;
+	}
+
+	template<typename... Ts>
+	template<typename T>
+	const T* variant<List<Ts...>>::get_if(Tag<T> t) const
+	{
+		return holds(t) ? this->get(t) : nullptr;
+	}
+
+	template<typename... Ts>
+	template<typename F>
+	decltype(auto) variant<List<Ts...>>::visit(F&& f) &
+	{
+		return Base::visit_index(this->index_, [this, &f](auto t) -> decltype(auto) {
+			return std::forward<F>(f)(*this->get(t));
+		});
+	}
+
+	template<typename... Ts>
+	template<typename F>
+	decltype(auto) variant<List<Ts...>>::visit(F&& f) const &
+	{
+		return Base::visit_index(this->index_, [this, &f](auto t) -> decltype(auto) {
+			return std::forward<F>(f)(*this->get(t));
+		});
+	}
+
+	template<typename... Ts>
+	template<typename F>
+	decltype(auto) variant<List<Ts...>>::visit(F&& f) &&
+	{
+		return Base::visit_index(this->index_, [this, &f](auto t) -> decltype(auto) {
+			return std::forward<F>(f)(std::move(*this->get(t)));
+		});
+	}
+
+	/** Variant **/
+
+	/* END OF IMPLEMENTATION */
+	/*************************************************************************************************************/
+
+} // namespace ST